@@ -0,0 +1,125 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+// Measures construction time of custom discrete distributions (alias tables)
+void run_benchmark(const cli::Parser& parser, const unsigned int size)
+{
+    const size_t trials = parser.get<size_t>("trials");
+
+    std::mt19937 gen(size);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> probabilities(size);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        probabilities[i] = uniform(gen);
+    }
+
+    rocrand_discrete_distribution discrete_distribution;
+
+    // Warm-up
+    ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(), size, 0, &discrete_distribution));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Measurement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(), size, 0, &discrete_distribution));
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "Table size = "
+              << std::setw(10) << size
+              << ", Throughput = "
+              << std::setw(8) << (trials * size) /
+                    (elapsed.count() / 1e3 * (1 << 20))
+              << " MEntries/s, AvgTime (1 trial) = "
+              << std::setw(8) << elapsed.count() / trials
+              << " ms, Time (all) = "
+              << std::setw(8) << elapsed.count()
+              << " ms"
+              << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    parser.set_optional<std::vector<unsigned int>>("size", "size",
+        {1 << 10, 1 << 14, 1 << 16, 1 << 18, 1 << 20, 1 << 22, 1 << 24},
+        "space-separated list of table sizes");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of trials");
+    parser.run_and_exit_if_error();
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto size : parser.get<std::vector<unsigned int>>("size"))
+    {
+        run_benchmark(parser, size);
+    }
+
+    return 0;
+}
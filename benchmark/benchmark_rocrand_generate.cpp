@@ -144,6 +144,22 @@ void run_benchmarks(const cli::Parser& parser,
             }
         );
     }
+    if (distribution == "uniform-half")
+    {
+        run_benchmark<unsigned short>(parser, rng_type,
+            [](rocrand_generator gen, unsigned short * data, size_t size) {
+                return rocrand_generate_uniform_half(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-bf16")
+    {
+        run_benchmark<unsigned short>(parser, rng_type,
+            [](rocrand_generator gen, unsigned short * data, size_t size) {
+                return rocrand_generate_uniform_bf16(gen, data, size);
+            }
+        );
+    }
     if (distribution == "normal-float")
     {
         run_benchmark<float>(parser, rng_type,
@@ -160,6 +176,38 @@ void run_benchmarks(const cli::Parser& parser,
             }
         );
     }
+    if (distribution == "normal-half")
+    {
+        run_benchmark<unsigned short>(parser, rng_type,
+            [](rocrand_generator gen, unsigned short * data, size_t size) {
+                return rocrand_generate_normal_half(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "normal-bf16")
+    {
+        run_benchmark<unsigned short>(parser, rng_type,
+            [](rocrand_generator gen, unsigned short * data, size_t size) {
+                return rocrand_generate_normal_bf16(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "truncated-normal-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_truncated_normal(gen, data, size, 0.0f, 1.0f, 2.0f, 4.0f);
+            }
+        );
+    }
+    if (distribution == "truncated-normal-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_truncated_normal_double(gen, data, size, 0.0, 1.0, 2.0, 4.0);
+            }
+        );
+    }
     if (distribution == "log-normal-float")
     {
         run_benchmark<float>(parser, rng_type,
@@ -176,6 +224,31 @@ void run_benchmarks(const cli::Parser& parser,
             }
         );
     }
+    if (distribution == "bernoulli-bits")
+    {
+        // size is the number of 32-bit masks
+        const auto ps = parser.get<std::vector<double>>("p");
+        for (double p : ps)
+        {
+            std::cout << "    " << "p "
+                 << std::fixed << std::setprecision(2) << p << std::endl;
+            run_benchmark<unsigned int>(parser, rng_type,
+                [p](rocrand_generator gen, unsigned int * data, size_t size) {
+                    return rocrand_generate_bernoulli_bits(gen, data, size * 32, p);
+                }
+            );
+        }
+    }
+    if (distribution == "latin-hypercube" && rng_type != ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        // size is the number of values, points have --lhs-dimensions values
+        const size_t dimensions = parser.get<size_t>("lhs-dimensions");
+        run_benchmark<float>(parser, rng_type,
+            [dimensions](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_latin_hypercube(gen, data, size / dimensions, dimensions);
+            }
+        );
+    }
     if (distribution == "poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
@@ -205,10 +278,18 @@ const std::vector<std::string> all_distributions = {
     // "uniform-long-long",
     "uniform-float",
     "uniform-double",
+    "uniform-half",
+    "uniform-bf16",
     "normal-float",
     "normal-double",
+    "normal-half",
+    "normal-bf16",
+    "truncated-normal-float",
+    "truncated-normal-double",
     "log-normal-float",
     "log-normal-double",
+    "bernoulli-bits",
+    "latin-hypercube",
     "poisson"
 };
 
@@ -235,9 +316,11 @@ int main(int argc, char *argv[])
 
     parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
     parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
+    parser.set_optional<size_t>("lhs-dimensions", "lhs-dimensions", 1024, "number of dimensions of Latin hypercube points");
     parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.set_optional<std::vector<double>>("p", "p", {0.1, 0.5}, "space-separated list of probabilities of Bernoulli bits");
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
     parser.run_and_exit_if_error();
 
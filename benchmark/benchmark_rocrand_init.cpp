@@ -0,0 +1,214 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+// Measures latency of (re)initialization of generator's states:
+// every trial sets a new seed (cycling through --seeds values) and generates
+// --size values, which triggers initialization. The time of generation
+// without reinitialization is measured separately and subtracted.
+void run_benchmark(const cli::Parser& parser,
+                   const rng_type_t rng_type,
+                   const unsigned int cache_size)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+    const size_t seeds = parser.get<size_t>("seeds");
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if (cache_size > 0)
+    {
+        ROCRAND_CHECK(rocrand_set_engine_cache_size(generator, cache_size));
+    }
+
+    // Warm-up
+    for (size_t i = 0; i < std::max<size_t>(5, seeds); i++)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1 + i % seeds));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generation only
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> generate_elapsed = end - start;
+
+    // Initialization and generation
+    start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1 + i % seeds));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "      "
+              << "Cache = " << std::setw(3) << cache_size
+              << ", AvgTime (1 init) = "
+              << std::setw(8) << (elapsed.count() - generate_elapsed.count()) / trials
+              << " ms, AvgTime (1 init + generate) = "
+              << std::setw(8) << elapsed.count() / trials
+              << " ms, Time (all) = "
+              << std::setw(8) << elapsed.count()
+              << " ms, Size = " << size
+              << std::endl;
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", 1024, "number of values generated after initialization");
+    parser.set_optional<size_t>("trials", "trials", 100, "number of trials");
+    parser.set_optional<size_t>("seeds", "seeds", 2, "number of seeds used in turn");
+    parser.set_optional<std::vector<unsigned int>>("cache", "cache", {0, 2}, "space-separated list of engine cache sizes (xorwow and mrg32k3a only)");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"xorwow", "mrg32k3a"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto engine : engines)
+    {
+        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+        else
+        {
+            std::cout << "Wrong engine name" << std::endl;
+            exit(1);
+        }
+
+        std::cout << engine << ":" << std::endl;
+
+        const bool cacheable = rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+            || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A;
+        for (auto cache_size : parser.get<std::vector<unsigned int>>("cache"))
+        {
+            if (cache_size > 0 && !cacheable)
+                continue;
+            run_benchmark(parser, rng_type, cache_size);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -20,6 +20,9 @@ elseif(HIP_PLATFORM STREQUAL "hcc")
     find_package(hip REQUIRED CONFIG PATHS /opt/rocm)
 endif()
 
+# Threads (used for building large discrete distribution tables)
+find_package(Threads REQUIRED)
+
 # For downloading, building, and installing required dependencies
 include(cmake/DownloadProject.cmake)
 
@@ -41,6 +41,8 @@
 /// \cond ROCRAND_DOCS_TYPEDEFS
 /// rocRAND random number generator (opaque)
 typedef struct rocrand_generator_base_type * rocrand_generator;
+/// rocRAND prefetcher of random numbers for host consumers (opaque)
+typedef struct rocrand_prefetcher_base_type * rocrand_prefetcher;
 /// \endcond
 
 #if defined(__cplusplus)
@@ -78,6 +80,29 @@ typedef enum rocrand_rng_type {
     ROCRAND_RNG_QUASI_SOBOL32 = 501 ///< Sobol32 quasirandom generator
 } rocrand_rng_type;
 
+/**
+ * \brief rocRAND launch tuning mode
+ *
+ * See rocrand_set_tuning_mode().
+ */
+typedef enum rocrand_tuning_mode {
+    ROCRAND_TUNING_DEFAULT = 0, ///< Default launch geometry is used
+    ROCRAND_TUNING_CACHED = 1, ///< Tuned launch geometry is used when available
+    ROCRAND_TUNING_AUTOTUNE = 2 ///< Launch geometry which is not tuned yet is measured
+} rocrand_tuning_mode;
+
+/**
+ * \brief rocRAND generator ordering
+ *
+ * See rocrand_set_ordering().
+ */
+typedef enum rocrand_ordering {
+    ROCRAND_ORDERING_PSEUDO_BEST = 100, ///< Best performance for the device, the sequence may differ between devices and versions
+    ROCRAND_ORDERING_PSEUDO_DEFAULT = 101, ///< Legacy ordering: values of the canonical subsequences (default)
+    ROCRAND_ORDERING_PSEUDO_SEEDED = 102, ///< Engines are seeded independently by hashes of the seed
+    ROCRAND_ORDERING_QUASI_DEFAULT = 201 ///< Default ordering of quasi-random generators
+} rocrand_ordering;
+
 
 // Host API function
 
@@ -122,6 +147,81 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator);
 
+/**
+ * \brief Creates a prefetcher of random numbers for host consumers.
+ *
+ * Creates a prefetcher which keeps \p blocks blocks of \p block_size
+ * uniformly distributed 32-bit unsigned integers generated ahead of time
+ * by \p generator in pinned host memory. Blocks are obtained with
+ * rocrand_next_block(), generation and copying of the following blocks
+ * overlap with processing of the current one on the host.
+ *
+ * The values are the same as the values generated by consecutive
+ * rocrand_generate() calls with \p block_size values. The generator must not
+ * be used for other generation or destroyed while the prefetcher exists,
+ * its stream may be changed with rocrand_set_stream().
+ *
+ * \param prefetcher - Pointer to prefetcher
+ * \param generator - Generator to use
+ * \param block_size - Number of values in a block
+ * \param blocks - Number of blocks, at least 2
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p prefetcher is NULL, \p block_size is 0
+ *   or \p blocks is less than 2 \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p block_size is not a multiple of
+ *   the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if the prefetcher was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_prefetcher(rocrand_prefetcher * prefetcher,
+                          rocrand_generator generator,
+                          size_t block_size,
+                          unsigned int blocks);
+
+/**
+ * \brief Returns the next block of random numbers.
+ *
+ * Waits until the next block is ready (usually it already is) and returns
+ * a pointer to it in host memory. The block returned by the previous call is
+ * reused for new values, so its data must not be used after this call.
+ *
+ * If generation of new values for the previous block fails, an error is
+ * returned and the next call tries again. A block is never returned twice.
+ *
+ * \param prefetcher - Prefetcher to use
+ * \param block - Pointer to the returned block
+ * \param n - Pointer to the number of values in the block
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the prefetcher wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p block or \p n is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the block was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_next_block(rocrand_prefetcher prefetcher,
+                   const unsigned int ** block,
+                   size_t * n);
+
+/**
+ * \brief Destroys prefetcher.
+ *
+ * Waits for blocks in flight and frees memory of the prefetcher.
+ * The generator is not destroyed.
+ *
+ * \param prefetcher - Prefetcher to be destroyed
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the prefetcher wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the prefetcher was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_prefetcher(rocrand_prefetcher prefetcher);
+
 /**
  * \brief Generates uniformly distributed 32-bit unsigned integers.
  *
@@ -146,6 +246,41 @@ rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers
+ * for many generators.
+ *
+ * Generates \p n[i] uniformly distributed 32-bit unsigned integers with
+ * \p generators[i] and saves them to \p output_data[i] for every \p i in
+ * <tt>[0, count)</tt>. Values are the same as values generated by
+ * rocrand_generate() calls for every generator in order.
+ *
+ * When all generators are distinct PHILOX4_32_10 generators or distinct
+ * XORWOW generators and use the same stream, all requests are done by one
+ * kernel launch, which is much faster than separate calls for many small
+ * requests. Otherwise generators are used one by one.
+ *
+ * \param generators - Array of \p count generators
+ * \param output_data - Array of \p count pointers to memory to store
+ * generated numbers
+ * \param n - Array of \p count numbers of values to generate
+ * \param count - Number of generators
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if a generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p generators, \p output_data or \p n
+ *   is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n[i] is not a multiple of
+ *   the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_batched(rocrand_generator * generators,
+                         unsigned int ** output_data,
+                         const size_t * n,
+                         unsigned int count);
+
 /**
  * \brief Generates uniformly distributed \p float values.
  *
@@ -294,6 +429,683 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
                                    double * output_data, size_t n,
                                    double mean, double stddev);
 
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate() with
+ * <tt>width * height</tt> values, but stores value number
+ * <tt>r * width + c</tt> at <tt>output_data[r * pitch + c * stride]</tt>.
+ * Elements between the written values are not modified. This allows, for
+ * example, filling one component of an array of structures or a sub-matrix
+ * of a larger (pitched) allocation without an additional copy.
+ *
+ * \p stride and \p pitch are given in elements, not in bytes.
+ * \p pitch is ignored when \p height is 1.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance between consecutive values of a row
+ * \param pitch - Distance between the first values of consecutive rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap
+ * (<tt>pitch < (width - 1) * stride + 1</tt>) \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not a multiple
+ * of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_strided(rocrand_generator generator,
+                         unsigned int * output_data,
+                         size_t width, size_t height,
+                         size_t stride, size_t pitch);
+
+/**
+ * \brief Generates uniformly distributed \p float values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_uniform() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not a multiple
+ * of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_strided(rocrand_generator generator,
+                                 float * output_data,
+                                 size_t width, size_t height,
+                                 size_t stride, size_t pitch);
+
+/**
+ * \brief Generates uniformly distributed \p double values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_uniform_double() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not a multiple
+ * of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_strided(rocrand_generator generator,
+                                        double * output_data,
+                                        size_t width, size_t height,
+                                        size_t stride, size_t pitch);
+
+/**
+ * \brief Generates normally distributed \p float values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_normal() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not even,
+ * or is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_strided(rocrand_generator generator,
+                                float * output_data,
+                                size_t width, size_t height,
+                                size_t stride, size_t pitch,
+                                float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p double values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_normal_double() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not even,
+ * or is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_strided(rocrand_generator generator,
+                                       double * output_data,
+                                       size_t width, size_t height,
+                                       size_t stride, size_t pitch,
+                                       double mean, double stddev);
+
+/**
+ * \brief Generates log-normally distributed \p float values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_log_normal() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not even,
+ * or is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_strided(rocrand_generator generator,
+                                    float * output_data,
+                                    size_t width, size_t height,
+                                    size_t stride, size_t pitch,
+                                    float mean, float stddev);
+
+/**
+ * \brief Generates log-normally distributed \p double values into strided memory.
+ *
+ * Generates the same sequence as rocrand_generate_log_normal_double() with
+ * <tt>width * height</tt> values and stores them at
+ * <tt>output_data[r * pitch + c * stride]</tt> (see rocrand_generate_strided()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param width - Number of values in a row
+ * \param height - Number of rows
+ * \param stride - Distance in elements between consecutive values of a row
+ * \param pitch - Distance in elements between the first values of consecutive rows
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 or rows overlap \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if <tt>width * height</tt> is not even,
+ * or is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double_strided(rocrand_generator generator,
+                                           double * output_data,
+                                           size_t width, size_t height,
+                                           size_t stride, size_t pitch,
+                                           double mean, double stddev);
+
+/**
+ * \brief Generates uniformly distributed \p half values.
+ *
+ * Generates \p n uniformly distributed 16-bit half-precision (IEEE 754 binary16) floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * Values are stored as their 16-bit patterns. Pseudo-random generators
+ * produce two values from each 32-bit random number.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to 4 bytes (pseudo-random generators), or \p n is not
+ * a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              unsigned short * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p bfloat16 values.
+ *
+ * Generates \p n uniformly distributed 16-bit bfloat16 floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * Values are stored as their 16-bit patterns. Pseudo-random generators
+ * produce two values from each 32-bit random number.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to 4 bytes (pseudo-random generators), or \p n is not
+ * a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bf16(rocrand_generator generator,
+                              unsigned short * output_data, size_t n);
+
+/**
+ * \brief Generates normally distributed \p half values.
+ *
+ * Generates \p n normally distributed 16-bit half-precision (IEEE 754 binary16) floating-point
+ * values and saves them to \p output_data.
+ *
+ * Values are stored as their 16-bit patterns. Pseudo-random generators
+ * produce each pair of values from two 32-bit random numbers in float
+ * precision, so tails are the same as for normal float values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to 4 bytes (pseudo-random generators), or \p n is not
+ * a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             unsigned short * output_data, size_t n,
+                             float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p bfloat16 values.
+ *
+ * Generates \p n normally distributed 16-bit bfloat16 floating-point
+ * values and saves them to \p output_data.
+ *
+ * Values are stored as their 16-bit patterns. Pseudo-random generators
+ * produce each pair of values from two 32-bit random numbers in float
+ * precision, so tails are the same as for normal float values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to 4 bytes (pseudo-random generators), or \p n is not
+ * a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_bf16(rocrand_generator generator,
+                             unsigned short * output_data, size_t n,
+                             float mean, float stddev);
+
+/**
+ * \brief Generates truncated normally distributed \p float values.
+ *
+ * Generates \p n \p float values from the normal distribution with mean
+ * \p mean and standard deviation \p stddev truncated to [\p lower, \p upper],
+ * and saves them to \p output_data.
+ *
+ * Intervals that contain the central part of the distribution are sampled
+ * by inversion of the CDF. Tail intervals are sampled by rejection with
+ * exponential or uniform proposals (Robert, 1995) inside the generation kernel.
+ * Quasi-random generators use inversion of the CDF for all intervals.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is not positive or \p lower
+ * is not less than \p upper \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lower, float upper);
+
+/**
+ * \brief Generates truncated normally distributed \p double values.
+ *
+ * Generates \p n \p double values from the normal distribution with mean
+ * \p mean and standard deviation \p stddev truncated to [\p lower, \p upper],
+ * and saves them to \p output_data.
+ *
+ * Intervals that contain the central part of the distribution are sampled
+ * by inversion of the CDF. Tail intervals are sampled by rejection with
+ * exponential or uniform proposals (Robert, 1995) inside the generation kernel.
+ * Quasi-random generators use inversion of the CDF for all intervals.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is not positive or \p lower
+ * is not less than \p upper \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lower, double upper);
+
+/**
+ * \brief Generates correlated normally distributed vectors.
+ *
+ * Generates \p n_vectors vectors <tt>y = mean + L * z</tt>, where \p z
+ * consists of \p dimensions independent standard normal values and \p L is
+ * the lower-triangular factor \p factor (for example, the Cholesky factor of
+ * the covariance matrix), and saves them to \p output_data.
+ *
+ * Output is dimension-blocked: value \p d of vector \p i is stored at
+ * <tt>output_data[d * n_vectors + i]</tt>.
+ *
+ * Quasi-random generators use one point of the sequence for each vector,
+ * so \p dimensions must be equal to the dimension of the generator.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors,
+ * at least <tt>n_vectors * dimensions</tt> values
+ * \param n_vectors - Number of vectors to generate
+ * \param dimensions - Number of values in each vector
+ * \param mean - Pointer to device memory with \p dimensions mean values,
+ * or NULL for zero mean
+ * \param factor - Pointer to device memory with the lower-triangular factor
+ * stored as a row-major <tt>dimensions x dimensions</tt> matrix, values above
+ * the diagonal are not used
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0, \p factor is NULL, or
+ * \p dimensions is not equal to the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n_vectors,
+                                     unsigned int dimensions,
+                                     const float * mean, const float * factor);
+
+/**
+ * \brief Generates Brownian motion paths with the Brownian bridge construction.
+ *
+ * Generates \p n_paths paths <tt>W(times[0]), ..., W(times[steps - 1])</tt> of
+ * the standard Brownian motion (<tt>W(0) = 0</tt>) and saves them to
+ * \p output_data.
+ *
+ * Each path uses one point of the quasi-random sequence: the k-th dimension
+ * of the point builds the time point <tt>ordering[k]</tt> from its nearest
+ * already built neighbours. The first dimensions have the best uniformity,
+ * so the default bisection ordering (the last point, then midpoints of
+ * intervals) gives them the largest part of the variance. Normal values
+ * are transformed as they are generated, no intermediate matrix is stored
+ * (short paths are built in shared memory and written coalesced).
+ *
+ * Output is path-major: value \p k of path \p i is stored at
+ * <tt>output_data[i * steps + k]</tt>.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated paths,
+ * at least <tt>n_paths * steps</tt> values
+ * \param n_paths - Number of paths to generate
+ * \param steps - Number of time points of each path, must be equal to
+ * the dimension of the generator
+ * \param times - Pointer to host memory with \p steps positive and strictly
+ * increasing times, or NULL for times <tt>1, 2, ..., steps</tt>
+ * \param ordering - Pointer to host memory with a permutation of
+ * <tt>[0, steps)</tt> defining the construction order, or NULL for the
+ * bisection ordering
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p steps is 0 or not equal to the dimension
+ * of the generator, \p times are not positive and strictly increasing or
+ * \p ordering is not a permutation \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_paths(rocrand_generator generator,
+                                float * output_data, size_t n_paths,
+                                unsigned int steps,
+                                const float * times,
+                                const unsigned int * ordering);
+
+/**
+ * \brief Generates Bernoulli-distributed bits packed into 32-bit words.
+ *
+ * Generates \p n_bits independent bits, each of them is 1 with probability
+ * \p p, and saves them to \p output_data. Bit \p i is stored in word
+ * <tt>i / 32</tt> at position <tt>i % 32</tt> (the least significant bit
+ * first). The values of bits past \p n_bits in the last word are unspecified.
+ *
+ * For pseudo-random generators and \p p = 0.5 the output contains
+ * random 32-bit numbers as they are generated by rocrand_generate().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated bit masks,
+ * at least <tt>(n_bits + 31) / 32</tt> words
+ * \param n_bits - Number of bits to generate
+ * \param p - Probability of a bit to be 1
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0, 1] \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n_bits is not a multiple of
+ * 32 times the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_bits(rocrand_generator generator,
+                                unsigned int * output_data, size_t n_bits,
+                                double p);
+
+/**
+ * \brief Generates uniformly distributed points on the unit sphere.
+ *
+ * Generates \p n unit vectors with \p dimensions values each, uniformly
+ * distributed on the surface of the unit sphere, and saves them to
+ * \p output_data. Values of each vector are stored contiguously.
+ *
+ * Vectors of 2 and 3 dimensions are generated directly from the angle of the
+ * Box-Muller transform and Archimedes' theorem, larger vectors are normalized
+ * normally distributed vectors.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated points,
+ * at least <tt>n * dimensions</tt> values
+ * \param n - Number of points to generate
+ * \param dimensions - Number of values in each point
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_sphere(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        unsigned int dimensions);
+
+/**
+ * \brief Generates uniformly distributed points in the unit ball.
+ *
+ * Generates \p n points with \p dimensions values each, uniformly
+ * distributed inside of the unit ball, and saves them to \p output_data.
+ * Values of each point are stored contiguously.
+ *
+ * Points are unit vectors (see rocrand_generate_sphere()) scaled by radii
+ * <tt>u^(1/dimensions)</tt>.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated points,
+ * at least <tt>n * dimensions</tt> values
+ * \param n - Number of points to generate
+ * \param dimensions - Number of values in each point
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_ball(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      unsigned int dimensions);
+
+/**
+ * \brief Generates uniformly distributed points on the unit simplex.
+ *
+ * Generates \p n points with \p dimensions non-negative values each that sum
+ * up to 1 (flat Dirichlet distribution), and saves them to \p output_data.
+ * Values of each point are stored contiguously.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated points,
+ * at least <tt>n * dimensions</tt> values
+ * \param n - Number of points to generate
+ * \param dimensions - Number of values in each point
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_simplex(rocrand_generator generator,
+                         float * output_data, size_t n,
+                         unsigned int dimensions);
+
+/**
+ * \brief Generates a random permutation of [0, n).
+ *
+ * Generates a random permutation of integers from 0 to <tt>n - 1</tt> and saves
+ * it to \p output_data.
+ *
+ * Every element is computed independently by a Feistel network keyed by random
+ * numbers of the generator, so the permutation takes O(n) work and no sorting.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store the permutation
+ * \param n - Number of elements, at most 2^32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n is greater than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if the permutation was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data, size_t n);
+
+/**
+ * \brief Samples integers from [0, n) without replacement.
+ *
+ * Generates \p k distinct integers from 0 to <tt>n - 1</tt> and saves them to
+ * \p output_data. The result consists of the first \p k elements of a random
+ * permutation of [0, n), it takes O(k) work.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store the sample
+ * \param k - Number of integers to sample
+ * \param n - Number of integers to sample from, at most 2^32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p k is greater than \p n or \p n is
+ * greater than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if the sample was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   size_t k, size_t n);
+
+/**
+ * \brief Generates Latin hypercube samples.
+ *
+ * Generates \p n_points points with \p dimensions values each and saves
+ * them to \p output_data. Values of every dimension are stratified: for each
+ * <tt>i</tt> in <tt>[0, n_points)</tt> exactly one value lies in the stratum
+ * <tt>[i / n_points, (i + 1) / n_points)</tt>, the value inside its stratum
+ * is uniformly distributed. Strata of different dimensions are permuted
+ * independently.
+ *
+ * Output is dimension-blocked, like the output of quasi-random generators:
+ * value \p d of point \p i is stored at <tt>output_data[d * n_points + i]</tt>.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated points,
+ * at least <tt>n_points * dimensions</tt> values
+ * \param n_points - Number of points to generate, at most 2^24
+ * (narrower strata may contain no \p float values)
+ * \param dimensions - Number of values in each point
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 or \p n_points is
+ * greater than 2^24 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                 float * output_data, size_t n_points,
+                                 unsigned int dimensions);
+
 /**
  * \brief Generates Poisson-distributed 32-bit unsigned integers.
  *
@@ -318,6 +1130,42 @@ rocrand_generate_poisson(rocrand_generator generator,
                          unsigned int * output_data, size_t n,
                          double lambda);
 
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers with
+ * a separate lambda for every value.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data. The i-th value is generated using
+ * lambda \p lambdas[i].
+ *
+ * Unlike rocrand_generate_poisson(), no tables are precomputed on the host:
+ * every value is sampled directly on the device (Knuth's multiplication
+ * method for small lambdas, rejection method PA for large lambdas, and normal
+ * approximation for huge lambdas). Generators which require exactly one
+ * random number per value (ROCRAND_RNG_QUASI_SOBOL32 and ROCRAND_RNG_PSEUDO_MTGP32)
+ * use inversion instead.
+ *
+ * Values generated for non-positive lambdas are zero.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param lambdas - Pointer to device memory with \p n lambdas
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambdas is NULL \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas,
+                               size_t n);
+
 /**
  * \brief Initializes the generator's state on GPU or host.
  *
@@ -328,6 +1176,10 @@ rocrand_generate_poisson(rocrand_generator generator,
  * automatically called by functions which generates random numbers like
  * rocrand_generate(), rocrang_generate_uniform() etc.
  *
+ * Pseudo-random generators XORWOW, MRG32K3A and PHILOX4_32_10 allocate and
+ * initialize only states needed by the largest request so far, this function
+ * initializes all of them. Generated values do not depend on it.
+ *
  * \param generator - Generator to initialize
  *
  * \return
@@ -344,11 +1196,16 @@ rocrand_initialize_generator(rocrand_generator generator);
  * Sets the current stream for all kernel launches of the generator.
  * All functions will use this stream.
  *
+ * The function does not block the host, but work enqueued later on
+ * \p stream waits for the work of the generator already enqueued on
+ * the previous stream.
+ *
  * \param generator - Generator to modify
  * \param stream - Stream to use or NULL for default stream
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the streams could not be ordered \n
  * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
  */
 rocrand_status ROCRANDAPI
@@ -398,6 +1255,74 @@ rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
 rocrand_status ROCRANDAPI
 rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
 
+/**
+ * \brief Sets the ordering of a random number generator.
+ *
+ * The ordering defines how values of engines of the generator are arranged
+ * in the output, it allows to trade the canonical sequence for faster
+ * initialization and generation.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed and offset.
+ *
+ * Values for \p order are:
+ * - ROCRAND_ORDERING_PSEUDO_DEFAULT - default ordering of pseudo-random
+ *   generators. Engine \p i starts at subsequence \p i of the seed (skipped
+ *   by jump-ahead), values are the same on all devices.
+ * - ROCRAND_ORDERING_PSEUDO_SEEDED - engines of XORWOW and MRG32K3A
+ *   generators are initialized with seeds derived from \p seed and
+ *   engine ids instead of subsequence jumps, which makes initialization
+ *   much cheaper. Sequences of engines are not guaranteed not to overlap,
+ *   but they are very unlikely to overlap because of long periods.
+ * - ROCRAND_ORDERING_PSEUDO_BEST - the number of engines is chosen for
+ *   the current device. XORWOW and MRG32K3A engines are seeded as in
+ *   ROCRAND_ORDERING_PSEUDO_SEEDED. Values may differ between devices and
+ *   versions of the library.
+ * - ROCRAND_ORDERING_QUASI_DEFAULT - the only ordering of quasi-random
+ *   generators.
+ *
+ * PHILOX4_32_10 does not support ROCRAND_ORDERING_PSEUDO_SEEDED (its jumps
+ * are already cheap). MTGP32 does not support ROCRAND_ORDERING_PSEUDO_SEEDED,
+ * its ROCRAND_ORDERING_PSEUDO_BEST is the same as the default ordering.
+ *
+ * \param generator - Random number generator
+ * \param order - New ordering
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the ordering is not valid for
+ *   the generator's type \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
+
+/**
+ * \brief Set the number of cached engine states of a random number generator.
+ *
+ * Generators keep up to \p entries copies of their engine states initialized
+ * for the most recently used pairs of seed and offset. When the generator is
+ * reset to one of these seeds and offsets (see rocrand_set_seed() and
+ * rocrand_set_offset()), the states are restored by a device-to-device copy
+ * instead of being initialized again with jump-ahead.
+ *
+ * Each entry takes as much device memory as the generator's engine states.
+ * By default the cache is disabled (\p entries is 0), setting \p entries to 0
+ * releases all cached states.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_XORWOW and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator - Random number generator
+ * \param entries - Maximum number of cached engine states
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not support caching \n
+ * - ROCRAND_STATUS_SUCCESS if the cache size was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_engine_cache_size(rocrand_generator generator, unsigned int entries);
+
 /**
  * \brief Set the number of dimensions of a quasi-random number generator.
  *
@@ -435,6 +1360,70 @@ rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
 rocrand_status ROCRANDAPI
 rocrand_get_version(int * version);
 
+/**
+ * \brief Sets limits of the generator's cache of Poisson distribution tables.
+ *
+ * rocrand_generate_poisson() precomputes tables for every lambda and keeps
+ * them in a cache, so switching between a few lambdas does not recompute them.
+ * When the number of cached tables exceeds \p max_tables or their total size
+ * exceeds \p max_bytes, the least recently used tables are freed. The table
+ * used by the last generation is always kept.
+ *
+ * By default up to 8 tables and 64 MiB are cached.
+ *
+ * \param generator - Generator to modify
+ * \param max_tables - Maximum number of cached tables, must be positive
+ * \param max_bytes - Maximum total size of cached tables in bytes, 0 means no limit
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p max_tables is zero \n
+ * - ROCRAND_STATUS_SUCCESS if the limits were set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_poisson_cache_limits(rocrand_generator generator,
+                                 unsigned int max_tables,
+                                 size_t max_bytes);
+
+/**
+ * \brief Precomputes Poisson distribution tables for given lambdas.
+ *
+ * Builds tables for \p count lambdas from \p lambdas and adds them to the
+ * generator's cache (see rocrand_set_poisson_cache_limits()), so following
+ * rocrand_generate_poisson() calls with these lambdas do not compute them.
+ *
+ * \param generator - Generator to use
+ * \param lambdas - Pointer to \p count lambdas in host memory
+ * \param count - Number of lambdas
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambdas is NULL or any lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if the tables were computed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prewarm_poisson_cache(rocrand_generator generator,
+                              const double * lambdas,
+                              unsigned int count);
+
+/**
+ * \brief Returns statistics of the generator's cache of Poisson distribution tables.
+ *
+ * \param generator - Generator to use
+ * \param hits - Pointer to store the number of lookups which found cached tables
+ * \param misses - Pointer to store the number of lookups which computed tables
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hits or \p misses is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the statistics were returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_poisson_cache_stats(rocrand_generator generator,
+                                unsigned long long * hits,
+                                unsigned long long * misses);
+
 /**
  * \brief Construct the histogram for a Poisson distribution.
  *
@@ -453,6 +1442,30 @@ rocrand_status ROCRANDAPI
 rocrand_create_poisson_distribution(double lambda,
                                     rocrand_discrete_distribution * discrete_distribution);
 
+/**
+ * \brief Construct the compact histogram for a Poisson distribution.
+ *
+ * Same as rocrand_create_poisson_distribution(), but the alias table is
+ * stored as one 8-byte entry per value (32-bit fixed-point threshold and
+ * 32-bit alias in \p compact_alias) instead of separate \p probability and
+ * \p alias arrays, which are NULL. Memory and memory traffic of sampling are
+ * smaller; thresholds are rounded to 2^-32, so a sampled value may differ
+ * from the value sampled with rocrand_create_poisson_distribution() when
+ * the random number falls within rounding distance of a threshold.
+ *
+ * \param lambda - lambda for the Poisson distribution
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_poisson_distribution_compact(double lambda,
+                                            rocrand_discrete_distribution * discrete_distribution);
+
 /**
  * \brief Construct the histogram for a custom discrete distribution.
  *
@@ -477,11 +1490,39 @@ rocrand_create_discrete_distribution(const double * probabilities,
                                      unsigned int offset,
                                      rocrand_discrete_distribution * discrete_distribution);
 
+/**
+ * \brief Construct the compact histogram for a custom discrete distribution.
+ *
+ * Same as rocrand_create_discrete_distribution(), but the alias table is
+ * stored in the compact layout, see
+ * rocrand_create_poisson_distribution_compact().
+ *
+ * \param probabilities - probabilities of the the distribution in host memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_compact(const double * probabilities,
+                                             unsigned int size,
+                                             unsigned int offset,
+                                             rocrand_discrete_distribution * discrete_distribution);
+
 /**
  * \brief Destroy the histogram array for a discrete distribution.
  *
  * Destroy the histogram array for a discrete distribution created by
- * rocrand_create_poisson_distribution.
+ * rocrand_create_poisson_distribution, rocrand_create_discrete_distribution
+ * or their compact variants.
+ *
+ * The function synchronizes the device before releasing the memory, so all
+ * kernels that use \p discrete_distribution finish before it can be reused.
  *
  * \param discrete_distribution - pointer to the histogram in device memory
  *
@@ -492,6 +1533,89 @@ rocrand_create_discrete_distribution(const double * probabilities,
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution);
 
+/**
+ * \brief Sets the maximum size of memory cached by rocRAND.
+ *
+ * Device and host memory used by generators and distributions (engines,
+ * precomputed tables etc.) is allocated from internal pools. Freed memory
+ * is kept in the pools and reused by later allocations on the same stream
+ * without device-wide synchronization, so creating and destroying generators
+ * or changing Poisson lambda does not stall work on other streams.
+ *
+ * When the size of cached memory of a pool exceeds \p max_bytes, the least
+ * recently freed blocks are released. The default limit is 256 MiB,
+ * 0 disables caching.
+ *
+ * \param max_bytes - maximum size of cached memory in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_INTERNAL_ERROR if releasing memory failed \n
+ * - ROCRAND_STATUS_SUCCESS if the limit was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_memory_pool_limit(size_t max_bytes);
+
+/**
+ * \brief Releases all memory cached by rocRAND.
+ *
+ * Releases all free blocks of the internal memory pools (see
+ * rocrand_set_memory_pool_limit()). Memory used by existing generators and
+ * distributions is not affected.
+ *
+ * \return
+ * - ROCRAND_STATUS_INTERNAL_ERROR if releasing memory failed \n
+ * - ROCRAND_STATUS_SUCCESS if memory was released successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_trim_memory(void);
+
+/**
+ * \brief Sets the launch tuning mode.
+ *
+ * Kernels of generators XORWOW, MRG32K3A, PHILOX4_32_10 and SOBOL32 can be
+ * launched with different numbers of threads per block, the best one depends
+ * on the device, the generator, the distribution, the output type and
+ * the size of the request. The total number of threads of each launch is
+ * not changed, so generated values are the same in all modes.
+ *
+ * Values for \p mode are:
+ * - ROCRAND_TUNING_DEFAULT - default launch geometry is always used
+ * - ROCRAND_TUNING_CACHED - block sizes from the tuning cache are used
+ *   (default mode)
+ * - ROCRAND_TUNING_AUTOTUNE - launches of kernels and size classes
+ *   (powers of 2) which are not tuned yet use candidate block sizes in turn
+ *   and measure their times. When all candidates are measured, the fastest
+ *   one is used by next launches and stored in the tuning cache (see
+ *   rocrand_set_tuning_cache()).
+ *
+ * \param mode - tuning mode
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p mode is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_tuning_mode(rocrand_tuning_mode mode);
+
+/**
+ * \brief Sets the file of the launch tuning cache.
+ *
+ * Loads tuned block sizes from the file \p path (if it exists) and stores
+ * block sizes tuned later in it. Entries are keyed by the device name and
+ * its number of compute units, a file written by another version of rocRAND
+ * is ignored.
+ *
+ * The initial file is set by the environment variable ROCRAND_TUNING_CACHE,
+ * it is loaded when the first generator is created.
+ *
+ * \param path - path of the cache file, NULL disables the file
+ *
+ * \return
+ * - ROCRAND_STATUS_SUCCESS if the file was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_tuning_cache(const char * path);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
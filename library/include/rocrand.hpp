@@ -843,6 +843,155 @@ private:
     param_type m_params;
 };
 
+/// \cond
+namespace detail {
+
+// Streams of transform_distribution start at this subsequence, so they do not
+// overlap with subsequences used by rocRAND generators
+constexpr unsigned long long transform_subsequence_base = 1ULL << 32;
+constexpr unsigned int transform_threads = 256;
+constexpr unsigned int transform_blocks = 64;
+
+FQUALIFIERS
+uint4 transform_next(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand4(state);
+}
+
+FQUALIFIERS
+unsigned int transform_next(rocrand_state_xorwow * state)
+{
+    return rocrand(state);
+}
+
+FQUALIFIERS
+unsigned int transform_next(rocrand_state_mrg32k3a * state)
+{
+    return rocrand(state);
+}
+
+// Number of engine values used by one transform_next() call
+template<class State>
+struct transform_words
+{
+    static constexpr unsigned int value = 1;
+};
+
+template<>
+struct transform_words<rocrand_state_philox4x32_10>
+{
+    static constexpr unsigned int value = 4;
+};
+
+// Thread i writes outputs i, i + stride, ..., and uses one word for each
+// of them from its own stream starting at offset
+template<class State, class T, class Function>
+__global__
+void transform_kernel(T * output, const size_t size,
+                      const unsigned long long seed,
+                      const unsigned long long offset,
+                      Function function)
+{
+    const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    State state;
+    rocrand_init(seed, transform_subsequence_base + thread_id, offset, &state);
+    for(size_t index = thread_id; index < size; index += stride)
+    {
+        output[index] = function(transform_next(&state));
+    }
+}
+
+} // end namespace detail
+/// \endcond
+
+/// \class transform_distribution
+///
+/// \brief Produces values returned by a user-provided functor applied to raw random words.
+///
+/// transform_distribution calls \p function on random words inside of
+/// the generation kernel, so custom distributions and post-processing
+/// (scaling, clamping, quantization) do not need a second pass over the output.
+/// The kernel is compiled as part of the calling program, \p Function must be
+/// a copyable type with <tt>__host__ __device__</tt> or <tt>__device__</tt>
+/// <tt>operator()</tt> taking \p uint4 (\p philox4x32_10_engine) or
+/// <tt>unsigned int</tt> (\p xorwow_engine, \p mrg32k3a_engine) and returning
+/// a value convertible to \p T.
+///
+/// Words are taken from streams of the engine's seed which do not overlap with
+/// values generated by other distributions, consecutive calls continue
+/// the streams. Setting the seed or the offset of the engine restarts them.
+/// Engines constructed from \p rocrand_generator use their \p DefaultSeed
+/// for these streams until seed() is called.
+/// Other engines are not supported.
+///
+/// \tparam T - type of generated values
+/// \tparam Function - type of the functor
+template<class T, class Function>
+class transform_distribution
+{
+public:
+    typedef T result_type;
+
+    /// Constructs the distribution applying \p function.
+    transform_distribution(Function function = Function())
+        : m_function(function)
+    {
+    }
+
+    /// Resets distribution's internal state if there is any.
+    void reset()
+    {
+    }
+
+    /// Returns the functor applied to random words.
+    Function function() const
+    {
+        return m_function;
+    }
+
+    /// \brief Fills \p output with values returned by the functor.
+    ///
+    /// Generates \p size values, each of them is the result of the functor
+    /// applied to one random word, and stores them into the device memory
+    /// referenced by \p output pointer. The kernel is launched on the engine's
+    /// stream.
+    ///
+    /// \param g - \p philox4x32_10_engine, \p xorwow_engine or \p mrg32k3a_engine
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// Requirements:
+    /// * The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p T type.
+    template<class Generator>
+    void operator()(Generator& g, T * output, size_t size)
+    {
+        typedef typename Generator::transform_state_type state_type;
+        const unsigned int threads = detail::transform_threads;
+        const unsigned int blocks = detail::transform_blocks;
+        const unsigned long long stride = threads * blocks;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_kernel<state_type, T, Function>),
+            dim3(blocks), dim3(threads), 0, g.m_stream,
+            output, size,
+            g.m_seed, g.m_transform_offset * detail::transform_words<state_type>::value,
+            m_function
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+        }
+        // Each thread used at most this many words
+        g.m_transform_offset += (size + stride - 1) / stride;
+    }
+
+private:
+    Function m_function;
+};
+
 /// \brief Pseudorandom number engine based Philox algorithm.
 ///
 /// philox4x32_10_engine implements
@@ -881,6 +1030,7 @@ public:
     /// See also: rocrand_create_generator()
     philox4x32_10_engine(seed_type seed_value = DefaultSeed,
                          offset_type offset_value = 0)
+        : m_seed(seed_value), m_transform_offset(0), m_stream(0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
@@ -901,7 +1051,8 @@ public:
     ///
     /// \param generator - rocRAND generator
     philox4x32_10_engine(rocrand_generator& generator)
-        : m_generator(generator)
+        : m_generator(generator),
+          m_seed(DefaultSeed), m_transform_offset(0), m_stream(0)
     {
         if(generator == NULL)
         {
@@ -925,6 +1076,7 @@ public:
     {
         rocrand_status status = rocrand_set_stream(m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_stream = value;
     }
 
     /// \brief Sets the offset of a random number engine.
@@ -942,6 +1094,7 @@ public:
     {
         rocrand_status status = rocrand_set_offset(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_transform_offset = 0;
     }
 
     /// \brief Sets the seed of the pseudo-random number engine.
@@ -956,6 +1109,8 @@ public:
     {
         rocrand_status status = rocrand_set_seed(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_seed = value;
+        m_transform_offset = 0;
     }
 
     /// \brief Fills \p output with uniformly distributed random integer values.
@@ -1000,6 +1155,12 @@ public:
 private:
     rocrand_generator m_generator;
 
+    // State of streams used by transform_distribution
+    typedef rocrand_state_philox4x32_10 transform_state_type;
+    seed_type m_seed;
+    unsigned long long m_transform_offset;
+    hipStream_t m_stream;
+
     /// \cond
     template<class T>
     friend class ::rocrand_cpp::uniform_int_distribution;
@@ -1015,6 +1176,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Function>
+    friend class ::rocrand_cpp::transform_distribution;
     /// \endcond
 };
 
@@ -1045,6 +1209,7 @@ public:
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
     xorwow_engine(seed_type seed_value = DefaultSeed,
                   offset_type offset_value = 0)
+        : m_seed(seed_value), m_transform_offset(0), m_stream(0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
@@ -1058,7 +1223,8 @@ public:
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
     xorwow_engine(rocrand_generator& generator)
-        : m_generator(generator)
+        : m_generator(generator),
+          m_seed(DefaultSeed), m_transform_offset(0), m_stream(0)
     {
         if(generator == NULL)
         {
@@ -1079,6 +1245,7 @@ public:
     {
         rocrand_status status = rocrand_set_stream(m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_stream = value;
     }
 
     /// \copydoc philox4x32_10_engine::offset()
@@ -1086,6 +1253,7 @@ public:
     {
         rocrand_status status = rocrand_set_offset(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_transform_offset = 0;
     }
 
     /// \copydoc philox4x32_10_engine::seed()
@@ -1093,6 +1261,8 @@ public:
     {
         rocrand_status status = rocrand_set_seed(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_seed = value;
+        m_transform_offset = 0;
     }
 
     /// \copydoc philox4x32_10_engine::operator()()
@@ -1125,6 +1295,12 @@ public:
 private:
     rocrand_generator m_generator;
 
+    // State of streams used by transform_distribution
+    typedef rocrand_state_xorwow transform_state_type;
+    seed_type m_seed;
+    unsigned long long m_transform_offset;
+    hipStream_t m_stream;
+
     /// \cond
     template<class T>
     friend class ::rocrand_cpp::uniform_int_distribution;
@@ -1140,6 +1316,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Function>
+    friend class ::rocrand_cpp::transform_distribution;
     /// \endcond
 };
 
@@ -1169,6 +1348,7 @@ public:
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
     mrg32k3a_engine(seed_type seed_value = DefaultSeed,
                     offset_type offset_value = 0)
+        : m_seed(seed_value), m_transform_offset(0), m_stream(0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
@@ -1182,7 +1362,8 @@ public:
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
     mrg32k3a_engine(rocrand_generator& generator)
-        : m_generator(generator)
+        : m_generator(generator),
+          m_seed(DefaultSeed), m_transform_offset(0), m_stream(0)
     {
         if(generator == NULL)
         {
@@ -1203,6 +1384,7 @@ public:
     {
         rocrand_status status = rocrand_set_stream(m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_stream = value;
     }
 
     /// \copydoc philox4x32_10_engine::offset()
@@ -1210,6 +1392,7 @@ public:
     {
         rocrand_status status = rocrand_set_offset(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_transform_offset = 0;
     }
 
     /// \copydoc philox4x32_10_engine::seed()
@@ -1217,6 +1400,8 @@ public:
     {
         rocrand_status status = rocrand_set_seed(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        m_seed = value;
+        m_transform_offset = 0;
     }
 
     /// \copydoc philox4x32_10_engine::operator()()
@@ -1249,6 +1434,12 @@ public:
 private:
     rocrand_generator m_generator;
 
+    // State of streams used by transform_distribution
+    typedef rocrand_state_mrg32k3a transform_state_type;
+    seed_type m_seed;
+    unsigned long long m_transform_offset;
+    hipStream_t m_stream;
+
     /// \cond
     template<class T>
     friend class ::rocrand_cpp::uniform_int_distribution;
@@ -1264,6 +1455,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Function>
+    friend class ::rocrand_cpp::transform_distribution;
     /// \endcond
 };
 
@@ -48,6 +48,17 @@
 namespace rocrand_device {
 namespace detail {
 
+FQUALIFIERS
+unsigned int discrete_alias_compact(const unsigned int i,
+                                    const unsigned int y,
+                                    const rocrand_discrete_distribution_st& dis)
+{
+    const unsigned long long entry = dis.compact_alias[i];
+    const unsigned int threshold = static_cast<unsigned int>(entry);
+    const unsigned int alias = static_cast<unsigned int>(entry >> 32);
+    return dis.offset + (y < threshold ? i : alias);
+}
+
 FQUALIFIERS
 unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_st& dis)
 {
@@ -58,12 +69,27 @@ unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_
     const double fnx = floor(nx);
     const double y = nx - fnx;
     const unsigned int i = static_cast<unsigned int>(fnx);
+    if (dis.compact_alias != NULL)
+    {
+        return discrete_alias_compact(
+            i, static_cast<unsigned int>(y * 4294967296.0), dis
+        );
+    }
     return dis.offset + (y < dis.probability[i] ? i : dis.alias[i]);
 }
 
 FQUALIFIERS
 unsigned int discrete_alias(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
+    if (dis.compact_alias != NULL)
+    {
+        // Fixed-point: the high half of r * size is the index,
+        // the low half is the fractional part
+        const unsigned long long nr = static_cast<unsigned long long>(r) * dis.size;
+        return discrete_alias_compact(
+            static_cast<unsigned int>(nr >> 32), static_cast<unsigned int>(nr), dis
+        );
+    }
     const double x = r * ROCRAND_2POW32_INV_DOUBLE;
     return discrete_alias(x, dis);
 }
@@ -75,7 +101,17 @@ unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st
 
     unsigned int min = 0;
     unsigned int max = dis.size - 1;
-    do
+    if (dis.guide != NULL)
+    {
+        // Indexed search (Chen and Asau, 1974): x * guide_size is exact
+        // because guide_size is a power of 2, so the answer is between
+        // the first indices of buckets k and k + 1.
+        const unsigned int g = static_cast<unsigned int>(x * dis.guide_size);
+        const unsigned int k = g < dis.guide_size ? g : dis.guide_size - 1;
+        min = dis.guide[k];
+        max = dis.guide[k + 1];
+    }
+    while (min != max)
     {
         const unsigned int center = (min + max) / 2;
         const double p = dis.cdf[center];
@@ -88,7 +124,6 @@ unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st
             max = center;
         }
     }
-    while (min != max);
 
     return dis.offset + min;
 }
@@ -32,6 +32,21 @@ struct rocrand_discrete_distribution_st
 
     // Cumulative distribution function
     double * cdf;
+
+    // Members below are appended after the original ones to keep the layout
+    // of the structure compatible
+
+    // Compact alias table: 32-bit fixed-point threshold (low half) and
+    // alias (high half) of each entry, used instead of alias and probability.
+    // NULL unless the distribution was created by
+    // rocrand_create_poisson_distribution_compact or
+    // rocrand_create_discrete_distribution_compact.
+    unsigned long long * compact_alias;
+
+    // Guide table for CDF: guide[k] is the first index i such that
+    // cdf[i] >= k / guide_size, guide_size is a power of 2
+    unsigned int guide_size;
+    unsigned int * guide;
 };
 
 typedef struct rocrand_discrete_distribution_st * rocrand_discrete_distribution;
@@ -0,0 +1,225 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_PERMUTATION_H_
+#define ROCRAND_PERMUTATION_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_mtgp32.h"
+
+// Random permutations of [0, n) without sorting
+//
+// A balanced Feistel network with random round keys is a bijection of
+// [0, 4^h) for any round function. Values that fall outside of [0, n) are
+// encrypted again (cycle walking) until they are in the range, this keeps
+// the mapping a bijection of [0, n). 4^h < 4n, so less than 4 encryptions
+// are needed on average. Every index is permuted independently, so
+// a permutation of n elements is O(n) work and completely parallel.
+
+#define ROCRAND_PERMUTATION_ROUNDS 6
+
+/**
+ * \brief Random permutation of [0, n).
+ */
+struct rocrand_permutation
+{
+    unsigned long long n;
+    unsigned int half_bits;
+    unsigned int keys[ROCRAND_PERMUTATION_ROUNDS];
+};
+
+namespace rocrand_device {
+namespace detail {
+
+FQUALIFIERS
+unsigned int permutation_half_bits(const unsigned long long n)
+{
+    unsigned int half_bits = 1;
+    while(half_bits < 16 && (1ULL << (2 * half_bits)) < n)
+    {
+        half_bits++;
+    }
+    return half_bits;
+}
+
+FQUALIFIERS
+unsigned int feistel_round(unsigned int x, const unsigned int key)
+{
+    // Finalizer of MurmurHash3
+    x ^= key;
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
+}
+
+FQUALIFIERS
+unsigned int feistel_encrypt(const unsigned int x,
+                             const unsigned int * keys,
+                             const unsigned int half_bits)
+{
+    const unsigned int mask = (1U << half_bits) - 1;
+    unsigned int left = (x >> half_bits) & mask;
+    unsigned int right = x & mask;
+    for(unsigned int round = 0; round < ROCRAND_PERMUTATION_ROUNDS; round++)
+    {
+        const unsigned int t = right;
+        right = left ^ (feistel_round(right, keys[round]) & mask);
+        left = t;
+    }
+    return (left << half_bits) | right;
+}
+
+// Returns the i-th element of the permutation of [0, n), i < n
+FQUALIFIERS
+unsigned int permute(unsigned int i,
+                     const unsigned long long n,
+                     const unsigned int * keys,
+                     const unsigned int half_bits)
+{
+    do
+    {
+        i = feistel_encrypt(i, keys, half_bits);
+    } while(i >= n);
+    return i;
+}
+
+template<class State>
+FQUALIFIERS
+void init_permutation(const unsigned long long n, State * state, rocrand_permutation * permutation)
+{
+    permutation->n = n;
+    permutation->half_bits = permutation_half_bits(n);
+    for(unsigned int round = 0; round < ROCRAND_PERMUTATION_ROUNDS; round++)
+    {
+        permutation->keys[round] = rocrand(state);
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Initializes a random permutation of [0, \p n).
+ *
+ * Generates round keys of \p permutation using Philox generator in \p state,
+ * and increments position of the generator by ROCRAND_PERMUTATION_ROUNDS.
+ *
+ * \param n - Number of elements, at most 2^32
+ * \param state - Pointer to a state to use
+ * \param permutation - Pointer to a permutation to initialize
+ */
+FQUALIFIERS
+void rocrand_init_permutation(const unsigned long long n,
+                              rocrand_state_philox4x32_10 * state,
+                              rocrand_permutation * permutation)
+{
+    rocrand_device::detail::init_permutation(n, state, permutation);
+}
+
+/**
+ * \brief Initializes a random permutation of [0, \p n).
+ *
+ * Generates round keys of \p permutation using MRG32K3A generator in \p state,
+ * and increments position of the generator by ROCRAND_PERMUTATION_ROUNDS.
+ *
+ * \param n - Number of elements, at most 2^32
+ * \param state - Pointer to a state to use
+ * \param permutation - Pointer to a permutation to initialize
+ */
+FQUALIFIERS
+void rocrand_init_permutation(const unsigned long long n,
+                              rocrand_state_mrg32k3a * state,
+                              rocrand_permutation * permutation)
+{
+    rocrand_device::detail::init_permutation(n, state, permutation);
+}
+
+/**
+ * \brief Initializes a random permutation of [0, \p n).
+ *
+ * Generates round keys of \p permutation using XORWOW generator in \p state,
+ * and increments position of the generator by ROCRAND_PERMUTATION_ROUNDS.
+ *
+ * \param n - Number of elements, at most 2^32
+ * \param state - Pointer to a state to use
+ * \param permutation - Pointer to a permutation to initialize
+ */
+FQUALIFIERS
+void rocrand_init_permutation(const unsigned long long n,
+                              rocrand_state_xorwow * state,
+                              rocrand_permutation * permutation)
+{
+    rocrand_device::detail::init_permutation(n, state, permutation);
+}
+
+/**
+ * \brief Initializes a random permutation of [0, \p n).
+ *
+ * Generates round keys of \p permutation using MTGP32 generator in \p state,
+ * and increments position of the generator by ROCRAND_PERMUTATION_ROUNDS.
+ *
+ * \param n - Number of elements, at most 2^32
+ * \param state - Pointer to a state to use
+ * \param permutation - Pointer to a permutation to initialize
+ */
+FQUALIFIERS
+void rocrand_init_permutation(const unsigned long long n,
+                              rocrand_state_mtgp32 * state,
+                              rocrand_permutation * permutation)
+{
+    rocrand_device::detail::init_permutation(n, state, permutation);
+}
+
+/**
+ * \brief Returns the element of a random permutation at position \p i.
+ *
+ * Elements at different positions are distinct, so the first \p k positions
+ * of a permutation of [0, n) are a sample of \p k elements without replacement.
+ *
+ * \param permutation - Pointer to an initialized permutation
+ * \param i - Position, must be less than the number of elements
+ *
+ * \return Element of the permutation
+ */
+FQUALIFIERS
+unsigned int rocrand_permute(const rocrand_permutation * permutation, const unsigned int i)
+{
+    return rocrand_device::detail::permute(
+        i, permutation->n, permutation->keys, permutation->half_bits
+    );
+}
+
+#endif // ROCRAND_PERMUTATION_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,521 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_TRUNCATED_NORMAL_H_
+#define ROCRAND_TRUNCATED_NORMAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_sobol32.h"
+#include "rocrand_mtgp32.h"
+
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+// Truncated normal distribution
+//
+// Intervals that contain the central part of the distribution are sampled
+// by inversion of the CDF, tail intervals (all values are at least
+// ROCRAND_TRUNCATED_NORMAL_TAIL standard deviations away from the mean)
+// are sampled by rejection:
+//
+// Robert C. P.
+// Simulation of truncated normal variables, 1995
+//
+// The proposal is exponential for wide intervals and uniform for narrow ones.
+// Each attempt of rejection sampling uses two uniform values.
+//
+// SOBOL32 (low discrepancy) and MTGP32 (all threads of a block draw values
+// together) use inversion for all intervals.
+
+#define ROCRAND_TRUNCATED_NORMAL_TAIL 1.0
+
+namespace rocrand_device {
+namespace detail {
+
+template<class T>
+struct truncated_normal_math;
+
+template<>
+struct truncated_normal_math<float>
+{
+    static FQUALIFIERS float exp(float x) { return expf(x); }
+    static FQUALIFIERS float log(float x) { return logf(x); }
+    static FQUALIFIERS float sqrt(float x) { return sqrtf(x); }
+
+    static FQUALIFIERS float cdf(float x)
+    {
+        return 0.5f * erfcf(-x / ROCRAND_SQRT2);
+    }
+
+    static FQUALIFIERS float inverse_cdf(float p)
+    {
+        return ROCRAND_SQRT2 * roc_f_erfinv(2.0f * p - 1.0f);
+    }
+};
+
+template<>
+struct truncated_normal_math<double>
+{
+    static FQUALIFIERS double exp(double x) { return ::exp(x); }
+    static FQUALIFIERS double log(double x) { return ::log(x); }
+    static FQUALIFIERS double sqrt(double x) { return ::sqrt(x); }
+
+    static FQUALIFIERS double cdf(double x)
+    {
+        return 0.5 * erfc(-x / ROCRAND_SQRT2_DOUBLE);
+    }
+
+    static FQUALIFIERS double inverse_cdf(double p)
+    {
+        return ROCRAND_SQRT2_DOUBLE * roc_d_erfinv(2.0 * p - 1.0);
+    }
+};
+
+enum truncated_normal_method
+{
+    TRUNCATED_NORMAL_INVERSE_CDF,
+    TRUNCATED_NORMAL_EXPONENTIAL,
+    TRUNCATED_NORMAL_UNIFORM
+};
+
+// Normal distribution with mean and stddev truncated to [lower, upper].
+// The parameters do not depend on random values, so they can be computed
+// once for many values.
+template<class T>
+struct truncated_normal_params
+{
+    typedef truncated_normal_math<T> math;
+
+    T mean;
+    T stddev;
+    // Bounds of the standard normal distribution. Intervals in the left tail
+    // are mirrored to the right tail, sign is -1 in this case.
+    T a;
+    T b;
+    T sign;
+    // CDF values at bounds
+    T cdf_a;
+    T cdf_b;
+    // Rate of the exponential proposal
+    T lambda;
+    truncated_normal_method method;
+
+    FQUALIFIERS
+    truncated_normal_params() { }
+
+    FQUALIFIERS
+    truncated_normal_params(T mean, T stddev, T lower, T upper)
+        : mean(mean), stddev(stddev)
+    {
+        a = (lower - mean) / stddev;
+        b = (upper - mean) / stddev;
+        sign = T(1);
+        if(b <= T(0))
+        {
+            const T t = a;
+            a = -b;
+            b = -t;
+            sign = T(-1);
+        }
+        cdf_a = math::cdf(a);
+        cdf_b = math::cdf(b);
+
+        const T s = math::sqrt(a * a + T(4));
+        lambda = (a + s) / T(2);
+        if(a < T(ROCRAND_TRUNCATED_NORMAL_TAIL))
+        {
+            method = TRUNCATED_NORMAL_INVERSE_CDF;
+        }
+        else if(b - a > T(2) / (a + s) * math::exp((a * a - a * s) / T(4) + T(0.5)))
+        {
+            method = TRUNCATED_NORMAL_EXPONENTIAL;
+        }
+        else
+        {
+            method = TRUNCATED_NORMAL_UNIFORM;
+        }
+    }
+
+    FQUALIFIERS
+    T scale(T x) const
+    {
+        return mean + stddev * sign * x;
+    }
+
+    // Returns a value for uniform u from (0; 1]
+    FQUALIFIERS
+    T inverse_cdf(T u) const
+    {
+        T x = math::inverse_cdf(cdf_a + u * (cdf_b - cdf_a));
+        // Rounding errors must not move values outside of the interval
+        x = x < a ? a : x;
+        x = x > b ? b : x;
+        return scale(x);
+    }
+
+    // One attempt of rejection sampling with uniform u1 and u2 from (0; 1],
+    // returns false if the proposal is rejected
+    FQUALIFIERS
+    bool rejection(T u1, T u2, T& result) const
+    {
+        T x;
+        T acceptance;
+        if(method == TRUNCATED_NORMAL_EXPONENTIAL)
+        {
+            x = a - math::log(u1) / lambda;
+            if(x > b)
+                return false;
+            acceptance = math::exp(-(x - lambda) * (x - lambda) / T(2));
+        }
+        else
+        {
+            x = a + (b - a) * u1;
+            acceptance = math::exp((a * a - x * x) / T(2));
+        }
+        if(u2 > acceptance)
+            return false;
+        result = scale(x);
+        return true;
+    }
+};
+
+template<class State>
+FQUALIFIERS
+float truncated_normal_uniform(State * state, float)
+{
+    return rocrand_uniform(state);
+}
+
+template<class State>
+FQUALIFIERS
+double truncated_normal_uniform(State * state, double)
+{
+    return rocrand_uniform_double(state);
+}
+
+template<class T, class State>
+FQUALIFIERS
+T truncated_normal(State * state, const truncated_normal_params<T>& params)
+{
+    if(params.method == TRUNCATED_NORMAL_INVERSE_CDF)
+    {
+        return params.inverse_cdf(truncated_normal_uniform(state, T()));
+    }
+    T result;
+    while(true)
+    {
+        const T u1 = truncated_normal_uniform(state, T());
+        const T u2 = truncated_normal_uniform(state, T());
+        if(params.rejection(u1, u2, result))
+            return result;
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a truncated normally distributed \p float value.
+ *
+ * Generates and returns a \p float value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using Philox generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_philox4x32_10 * state,
+                               float mean, float stddev, float lower, float upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<float>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p double value.
+ *
+ * Generates and returns a \p double value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using Philox generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_philox4x32_10 * state,
+                                       double mean, double stddev, double lower, double upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<double>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p float value.
+ *
+ * Generates and returns a \p float value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using MRG32K3A generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_mrg32k3a * state,
+                               float mean, float stddev, float lower, float upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<float>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p double value.
+ *
+ * Generates and returns a \p double value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using MRG32K3A generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_mrg32k3a * state,
+                                       double mean, double stddev, double lower, double upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<double>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p float value.
+ *
+ * Generates and returns a \p float value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using XORWOW generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_xorwow * state,
+                               float mean, float stddev, float lower, float upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<float>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p double value.
+ *
+ * Generates and returns a \p double value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using XORWOW generator in \p state.
+ * Intervals that contain the central part of the distribution use the inverse
+ * CDF method and one uniform value, tail intervals use rejection sampling
+ * with two uniform values per attempt.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_xorwow * state,
+                                       double mean, double stddev, double lower, double upper)
+{
+    return rocrand_device::detail::truncated_normal(
+        state, rocrand_device::detail::truncated_normal_params<double>(mean, stddev, lower, upper)
+    );
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p float value.
+ *
+ * Generates and returns a \p float value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using MTGP32 generator in \p state.
+ * All threads of a block must call the function together (see rocrand()).
+ * The inverse CDF method and exactly one uniform value are used for all
+ * intervals, so threads of the block stay in lockstep; far tails lose
+ * precision.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_mtgp32 * state,
+                               float mean, float stddev, float lower, float upper)
+{
+    // Rejection sampling would make threads draw different numbers of values,
+    // but MTGP32 requires all threads of a block to draw together
+    const rocrand_device::detail::truncated_normal_params<float> params(mean, stddev, lower, upper);
+    return params.inverse_cdf(rocrand_uniform(state));
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p double value.
+ *
+ * Generates and returns a \p double value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using MTGP32 generator in \p state.
+ * All threads of a block must call the function together (see rocrand()).
+ * The inverse CDF method and exactly one uniform value are used for all
+ * intervals, so threads of the block stay in lockstep; far tails lose
+ * precision.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_mtgp32 * state,
+                                       double mean, double stddev, double lower, double upper)
+{
+    // Rejection sampling would make threads draw different numbers of values,
+    // but MTGP32 requires all threads of a block to draw together
+    const rocrand_device::detail::truncated_normal_params<double> params(mean, stddev, lower, upper);
+    return params.inverse_cdf(rocrand_uniform_double(state));
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p float value.
+ *
+ * Generates and returns a \p float value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using SOBOL32 generator in \p state, and increments
+ * position of the generator by one.
+ * The inverse CDF method is used for all intervals, so the result keeps
+ * the low-discrepancy property of the sequence; far tails lose precision.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_sobol32 * state,
+                               float mean, float stddev, float lower, float upper)
+{
+    const rocrand_device::detail::truncated_normal_params<float> params(mean, stddev, lower, upper);
+    return params.inverse_cdf(rocrand_uniform(state));
+}
+
+/**
+ * \brief Returns a truncated normally distributed \p double value.
+ *
+ * Generates and returns a \p double value from the normal distribution with
+ * mean \p mean and standard deviation \p stddev truncated to
+ * [\p lower, \p upper] using SOBOL32 generator in \p state, and increments
+ * position of the generator by one.
+ * The inverse CDF method is used for all intervals, so the result keeps
+ * the low-discrepancy property of the sequence; far tails lose precision.
+ *
+ * \param state - Pointer to a state to use
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution, must be positive
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval, must be greater than \p lower
+ *
+ * \return Truncated normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_sobol32 * state,
+                                       double mean, double stddev, double lower, double upper)
+{
+    const rocrand_device::detail::truncated_normal_params<double> params(mean, stddev, lower, upper);
+    return params.inverse_cdf(rocrand_uniform_double(state));
+}
+
+#endif // ROCRAND_TRUNCATED_NORMAL_H_
+
+/** @} */ // end of group rocranddevice
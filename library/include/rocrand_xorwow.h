@@ -54,18 +54,30 @@ void copy_vec(unsigned int * dst, const unsigned int * src)
     }
 }
 
+// v = p(A) v, where A is the transition matrix of the xorshift part
+// and p is a polynomial of degree < XORWOW_N * XORWOW_M (Horner's scheme).
+// Every step is one xorshift step, so no jump matrices need to be read.
 FQUALIFIERS
-void mul_mat_vec_inplace(const unsigned int * m, unsigned int * v)
+void mul_poly_vec_inplace(const unsigned int * p, unsigned int * v)
 {
     unsigned int r[XORWOW_N] = { 0 };
-    for (int ij = 0; ij < XORWOW_N * XORWOW_M; ij++)
+    for (int i = XORWOW_N - 1; i >= 0; i--)
     {
-        const int i = ij / XORWOW_M;
-        const int j = ij % XORWOW_M;
-        const unsigned int b = (v[i] & (1 << j)) ? 0xffffffff : 0x0;
-        for (int k = 0; k < XORWOW_N; k++)
+        const unsigned int c = p[i];
+        for (int j = XORWOW_M - 1; j >= 0; j--)
         {
-            r[k] ^= b & m[i * XORWOW_M * XORWOW_N + j * XORWOW_N + k];
+            const unsigned int t = r[0] ^ (r[0] >> 2);
+            r[0] = r[1];
+            r[1] = r[2];
+            r[2] = r[3];
+            r[3] = r[4];
+            r[4] = (r[4] ^ (r[4] << 4)) ^ (t ^ (t << 1));
+
+            const unsigned int b = (c & (1U << j)) ? 0xffffffff : 0x0;
+            for (int k = 0; k < XORWOW_N; k++)
+            {
+                r[k] ^= b & v[k];
+            }
         }
     }
     copy_vec(v, r);
@@ -150,9 +162,9 @@ public:
     void discard(unsigned long long offset)
     {
         #ifdef __HIP_DEVICE_COMPILE__
-        jump(offset, d_xorwow_jump_matrices);
+        jump(offset, d_xorwow_jump_polynomials);
         #else
-        jump(offset, h_xorwow_jump_matrices);
+        jump(offset, h_xorwow_jump_polynomials);
         #endif
 
         // Apply n steps to Weyl sequence value as well
@@ -166,9 +178,9 @@ public:
     {
         // Discard n * 2^67 samples
         #ifdef __HIP_DEVICE_COMPILE__
-        jump(subsequence, d_xorwow_sequence_jump_matrices);
+        jump(subsequence, d_xorwow_sequence_jump_polynomials);
         #else
-        jump(subsequence, h_xorwow_sequence_jump_matrices);
+        jump(subsequence, h_xorwow_sequence_jump_polynomials);
         #endif
 
         // d has the same value because 2^67 is divisible by 2^32 (d is 32-bit)
@@ -199,29 +211,30 @@ protected:
 
     FQUALIFIERS
     void jump(unsigned long long v,
-              const unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE])
+              const unsigned int jump_polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES][XORWOW_N])
     {
         // x~(n + v) = (A^v mod m)x~n mod m
-        // The matrix (A^v mod m) can be precomputed for selected values of v.
-        //
-        // For XORWOW_JUMP_LOG2 = 2
-        // xorwow_jump_matrices contains precomputed matrices:
-        //   A^1, A^4, A^16...
+        // A^v = p(A), where p(x) = x^v mod P(x) and P is the characteristic
+        // polynomial of A (P(A) = 0), so p(A)x~n can be evaluated with
+        // 160 xorshift steps instead of multiplications by 160x160 matrices.
         //
-        // For XORWOW_JUMP_LOG2 = 2 and XORWOW_SEQUENCE_JUMP_LOG2 = 67
-        // xorwow_sequence_jump_matrices contains precomputed matrices:
-        //   A^(1 * 2^67), A^(4 * 2^67), A^(16 * 2^67)...
+        // v is split into digits of XORWOW_JUMP_LOG2 bits,
+        // jump_polynomials[i][j] = x^(j * 2^(XORWOW_JUMP_LOG2 * i)) mod P for
+        // xorwow_jump_polynomials, and
+        // jump_polynomials[i][j] = x^(j * 2^(XORWOW_JUMP_LOG2 * i) * 2^67) mod P for
+        // xorwow_sequence_jump_polynomials.
         //
-        // Intermediate powers can calculated as multiplication of the powers above.
+        // Hence at most one polynomial per digit is applied.
 
-        int mi = 0;
+        int i = 0;
         while (v > 0)
         {
-            for (int i = 0; i < (v & ((1 << XORWOW_JUMP_LOG2) - 1)); i++)
+            const unsigned int j = v & (XORWOW_JUMP_VALUES - 1);
+            if (j > 0)
             {
-                detail::mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+                detail::mul_poly_vec_inplace(jump_polynomials[i][j], m_state.x);
             }
-            mi++;
+            i++;
             v >>= XORWOW_JUMP_LOG2;
         }
     }
@@ -0,0 +1,102 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_BATCH_H_
+#define ROCRAND_RNG_BATCH_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "memory_pool.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Request of one generator in a batched launch (rocrand_generate_batched).
+// Threads [begin, begin + threads) of the batched grid do the work of threads
+// [0, threads) of the grid which the generator would launch for the request
+// alone (stride threads), so values are the same as of the separate call.
+template<class Engines>
+struct batch_item
+{
+    Engines engines;
+    unsigned int * data;
+    size_t n;
+    // Number of threads of the generator's own grid
+    unsigned int stride;
+    unsigned int begin;
+    unsigned int threads;
+};
+
+// Returns the index of the item which contains thread id, or count
+template<class Item>
+__forceinline__ __device__
+unsigned int find_batch_item(const Item * items, const unsigned int count,
+                             const unsigned int id)
+{
+    unsigned int low = 0;
+    unsigned int high = count;
+    while(low < high)
+    {
+        const unsigned int mid = (low + high) / 2;
+        if(items[mid].begin + items[mid].threads <= id)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
+// Copies items to device memory on stream, the returned pointer must be
+// freed with pool_free on stream after the launch
+template<class Item>
+inline rocrand_status upload_batch(const std::vector<Item>& items,
+                                   Item *& d_items,
+                                   hipStream_t stream)
+{
+    const size_t bytes = sizeof(Item) * items.size();
+    // The staging buffer is acquired first: acquire() throws and d_items
+    // would be leaked
+    staging_pool& staging = staging_pool::instance();
+    Item * buffer = static_cast<Item *>(staging.acquire(bytes));
+    if(pool_malloc(&d_items, bytes, stream) != hipSuccess)
+    {
+        staging.release(buffer, stream);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+
+    std::copy(items.begin(), items.end(), buffer);
+    const hipError_t error = hipMemcpyAsync(d_items, buffer, bytes, hipMemcpyHostToDevice, stream);
+    staging.release(buffer, stream);
+    if(error != hipSuccess)
+    {
+        pool_free(d_items, stream);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_BATCH_H_
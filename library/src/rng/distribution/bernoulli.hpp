@@ -0,0 +1,62 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+#define ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "uniform.hpp"
+
+// Packs results of 32 Bernoulli trials with probability of success p into
+// one unsigned integer: bit i is set if the i-th value is less than p * 2^32.
+// UniformDistribution scales values of the engine to 32-bit unsigned integers.
+template<class UniformDistribution = uniform_distribution<unsigned int> >
+struct bernoulli_bits_distribution
+{
+    // 64-bit, so p = 1 (2^32) sets all bits
+    unsigned long long threshold;
+
+    __host__ __device__
+    bernoulli_bits_distribution(double p = 0.5)
+        : threshold(static_cast<unsigned long long>(p * 4294967296.0 + 0.5)) {}
+
+    __forceinline__ __host__ __device__
+    unsigned int bit(const unsigned int v) const
+    {
+        return v < threshold ? 1U : 0U;
+    }
+
+    // Engine returns 32-bit values, 32 values are used
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    unsigned int operator()(Engine& engine) const
+    {
+        UniformDistribution uniform;
+        unsigned int word = 0;
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            word |= bit(uniform(engine())) << i;
+        }
+        return word;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
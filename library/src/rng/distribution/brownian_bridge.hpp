@@ -0,0 +1,287 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+#define ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+
+#include <math.h>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "../memory_pool.hpp"
+
+// Brownian bridge construction of Brownian motion paths W(t_0), ..., W(t_{steps-1})
+// (W(0) = 0) from standard normal values.
+//
+// The k-th normal value builds the point ordering[k] from its nearest already
+// built neighbours:
+//     W(t) = a * W(t_l) + b * W(t_r) + s * z
+// where t_l < t < t_r. The first values (the first dimensions of quasi-random
+// points, which have the best uniformity) determine the coarse shape of paths.
+struct brownian_bridge_step
+{
+    // Index of the built point
+    unsigned int index;
+    // Indices of the neighbours or steps if a neighbour is W(0) = 0 or does not exist
+    unsigned int left;
+    unsigned int right;
+    float left_weight;
+    float right_weight;
+    float stddev;
+};
+
+struct brownian_bridge_distribution
+{
+    unsigned int steps;
+    // Device pointer to the steps elements of the construction schedule
+    const brownian_bridge_step * schedule;
+
+    __host__ __device__
+    brownian_bridge_distribution()
+        : steps(0), schedule(NULL) {}
+
+    // Builds the point of the k-th step of a path from the standard normal value z
+    __forceinline__ __host__ __device__
+    void operator()(const unsigned int k, const float z, float * path) const
+    {
+        const brownian_bridge_step step = schedule[k];
+        const float left = step.left < steps ? path[step.left] : 0.0f;
+        const float right = step.right < steps ? path[step.right] : 0.0f;
+        path[step.index] = step.left_weight * left + step.right_weight * right + step.stddev * z;
+    }
+
+    // Builds all points of a path in place: before the call the point built by
+    // the k-th step holds the standard normal value of the k-th step (every
+    // point is read as a neighbour only after its own step)
+    __forceinline__ __host__ __device__
+    void build(float * path) const
+    {
+        for(unsigned int k = 0; k < steps; k++)
+        {
+            (*this)(k, path[schedule[k].index], path);
+        }
+    }
+};
+
+namespace rocrand_host {
+namespace detail {
+
+    // Coarse-to-fine bisection: the last point first, then midpoints of
+    // intervals in breadth-first order
+    inline std::vector<unsigned int> brownian_bridge_bisection(const unsigned int steps)
+    {
+        std::vector<unsigned int> ordering;
+        ordering.reserve(steps);
+        ordering.push_back(steps - 1);
+        // Intervals (l, r] where l = -1 is W(0)
+        std::vector<std::pair<int, int> > intervals(1, std::make_pair(-1, static_cast<int>(steps - 1)));
+        for(size_t i = 0; i < intervals.size(); i++)
+        {
+            const int l = intervals[i].first;
+            const int r = intervals[i].second;
+            if(r - l > 1)
+            {
+                const int m = l + (r - l) / 2;
+                ordering.push_back(m);
+                intervals.push_back(std::make_pair(l, m));
+                intervals.push_back(std::make_pair(m, r));
+            }
+        }
+        return ordering;
+    }
+
+    // Returns ROCRAND_STATUS_OUT_OF_RANGE if steps is 0, times are not positive
+    // and strictly increasing or ordering is not a permutation of [0, steps)
+    inline rocrand_status brownian_bridge_schedule(const unsigned int steps,
+                                                   const float * times,
+                                                   const unsigned int * ordering,
+                                                   std::vector<brownian_bridge_step>& schedule)
+    {
+        if(steps == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        std::vector<double> t(steps);
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            t[i] = times == NULL ? i + 1.0 : times[i];
+            if(!(t[i] > (i == 0 ? 0.0 : t[i - 1])))
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        const std::vector<unsigned int> order = ordering == NULL
+            ? brownian_bridge_bisection(steps)
+            : std::vector<unsigned int>(ordering, ordering + steps);
+
+        schedule.resize(steps);
+        std::set<unsigned int> built;
+        for(unsigned int k = 0; k < steps; k++)
+        {
+            const unsigned int i = order[k];
+            if(i >= steps || built.count(i) != 0)
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+
+            brownian_bridge_step& step = schedule[k];
+            step.index = i;
+            step.left = steps;
+            step.right = steps;
+            std::set<unsigned int>::const_iterator right = built.upper_bound(i);
+            if(right != built.begin())
+            {
+                std::set<unsigned int>::const_iterator left = right;
+                step.left = *--left;
+            }
+            if(right != built.end())
+            {
+                step.right = *right;
+            }
+            built.insert(i);
+
+            const double tl = step.left < steps ? t[step.left] : 0.0;
+            if(step.right < steps)
+            {
+                const double tr = t[step.right];
+                step.left_weight = static_cast<float>((tr - t[i]) / (tr - tl));
+                step.right_weight = static_cast<float>((t[i] - tl) / (tr - tl));
+                step.stddev = static_cast<float>(sqrt((t[i] - tl) * (tr - t[i]) / (tr - tl)));
+            }
+            else
+            {
+                step.left_weight = 1.0f;
+                step.right_weight = 0.0f;
+                step.stddev = static_cast<float>(sqrt(t[i] - tl));
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Keeps the construction schedule in device memory, the schedule is uploaded
+// only if the time grid or the ordering changes
+class brownian_bridge_manager
+{
+public:
+
+    brownian_bridge_manager()
+        : d_schedule(NULL), capacity(0), stream(0)
+    { }
+
+    brownian_bridge_manager(const brownian_bridge_manager&) = delete;
+    brownian_bridge_manager& operator=(const brownian_bridge_manager&) = delete;
+
+    ~brownian_bridge_manager()
+    {
+        rocrand_host::detail::pool_free(d_schedule, stream);
+    }
+
+    // times and ordering are host pointers to steps values or NULL
+    // (times 1, 2, ..., steps and the bisection ordering)
+    // The schedule is used on new_stream until the next call
+    rocrand_status set(const unsigned int steps,
+                       const float * times,
+                       const unsigned int * ordering,
+                       hipStream_t new_stream = 0)
+    {
+        std::vector<brownian_bridge_step> schedule;
+        rocrand_status status = rocrand_host::detail::brownian_bridge_schedule(
+            steps, times, ordering, schedule
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const hipStream_t last_stream = stream;
+        stream = new_stream;
+        if(d_schedule != NULL && same_schedule(schedule))
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(steps > capacity)
+        {
+            if(d_schedule != NULL)
+            {
+                rocrand_host::detail::pool_free(d_schedule, last_stream);
+                d_schedule = NULL;
+                capacity = 0;
+            }
+            hipError_t error = rocrand_host::detail::pool_malloc(
+                &d_schedule, sizeof(brownian_bridge_step) * steps, stream
+            );
+            if(error != hipSuccess)
+            {
+                d_schedule = NULL;
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            capacity = steps;
+        }
+        hipError_t error = hipMemcpyAsync(
+            d_schedule, schedule.data(),
+            sizeof(brownian_bridge_step) * steps,
+            hipMemcpyHostToDevice, stream
+        );
+        if(error == hipSuccess)
+        {
+            error = hipStreamSynchronize(stream);
+        }
+        if(error != hipSuccess)
+        {
+            h_schedule.clear();
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        h_schedule.swap(schedule);
+
+        dis.steps = steps;
+        dis.schedule = d_schedule;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Distribution for the schedule passed to the last set() call
+    brownian_bridge_distribution dis;
+
+private:
+
+    bool same_schedule(const std::vector<brownian_bridge_step>& schedule) const
+    {
+        if(schedule.size() != h_schedule.size())
+            return false;
+        for(size_t k = 0; k < schedule.size(); k++)
+        {
+            const brownian_bridge_step& a = schedule[k];
+            const brownian_bridge_step& b = h_schedule[k];
+            if(a.index != b.index || a.left != b.left || a.right != b.right
+                || a.left_weight != b.left_weight || a.right_weight != b.right_weight
+                || a.stddev != b.stddev)
+                return false;
+        }
+        return true;
+    }
+
+    brownian_bridge_step * d_schedule;
+    unsigned int capacity;
+    // Copy of the schedule in device memory
+    std::vector<brownian_bridge_step> h_schedule;
+    // Stream passed to the last set() call
+    hipStream_t stream;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
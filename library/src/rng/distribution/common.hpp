@@ -23,4 +23,128 @@
 
 #include "../common.hpp"
 
+namespace rocrand_host {
+namespace detail {
+
+FQUALIFIERS
+unsigned int float_as_uint(const float x)
+{
+    union { float f; unsigned int u; } v;
+    v.f = x;
+    return v.u;
+}
+
+FQUALIFIERS
+float uint_as_float(const unsigned int x)
+{
+    union { unsigned int u; float f; } v;
+    v.u = x;
+    return v.f;
+}
+
+// Converts float to IEEE 754 binary16 (half) bits, rounds to nearest even
+FQUALIFIERS
+unsigned short float_to_half(const float x)
+{
+    const unsigned int f = float_as_uint(x);
+    const unsigned int sign = (f >> 16) & 0x8000;
+    const unsigned int a = f & 0x7FFFFFFF;
+
+    if(a >= 0x7F800000)
+    {
+        // Inf or NaN
+        return sign | 0x7C00 | (a > 0x7F800000 ? 0x0200 : 0);
+    }
+    if(a >= 0x477FF000)
+    {
+        // Rounds to infinity
+        return sign | 0x7C00;
+    }
+    if(a < 0x38800000)
+    {
+        // Subnormal or zero
+        if(a < 0x33000000)
+        {
+            return sign;
+        }
+        const unsigned int shift = 126 - (a >> 23);
+        const unsigned int m = (a & 0x007FFFFF) | 0x00800000;
+        unsigned int r = m >> shift;
+        const unsigned int rem = m & ((1U << shift) - 1);
+        const unsigned int halfway = 1U << (shift - 1);
+        if(rem > halfway || (rem == halfway && (r & 1) != 0))
+        {
+            r++;
+        }
+        return sign | r;
+    }
+    // Rebias the exponent from 127 to 15
+    unsigned int r = (a - 0x38000000) >> 13;
+    const unsigned int rem = a & 0x1FFF;
+    if(rem > 0x1000 || (rem == 0x1000 && (r & 1) != 0))
+    {
+        r++;
+    }
+    return sign | r;
+}
+
+// Converts float to bfloat16 bits, rounds to nearest even
+FQUALIFIERS
+unsigned short float_to_bfloat16(const float x)
+{
+    const unsigned int f = float_as_uint(x);
+    if((f & 0x7FFFFFFF) > 0x7F800000)
+    {
+        // Quiet NaN
+        return (f >> 16) | 0x0040;
+    }
+    return (f + 0x7FFF + ((f >> 16) & 1)) >> 16;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// 16-bit floating point formats, values are stored as their bits
+// in unsigned short
+struct half_format
+{
+    // Low mantissa bits of float that do not fit into normal values
+    static const unsigned int dropped_bits = 13;
+
+    FQUALIFIERS
+    static unsigned short from_float(const float x)
+    {
+        return rocrand_host::detail::float_to_half(x);
+    }
+};
+
+struct bfloat16_format
+{
+    // Low mantissa bits of float that do not fit into normal values
+    static const unsigned int dropped_bits = 16;
+
+    FQUALIFIERS
+    static unsigned short from_float(const float x)
+    {
+        return rocrand_host::detail::float_to_bfloat16(x);
+    }
+};
+
+// Converts float values returned by Distribution to 16-bit Format
+template<class Format, class Distribution>
+struct float16_distribution
+{
+    Distribution distribution;
+
+    __host__ __device__
+    float16_distribution(const Distribution& distribution = Distribution())
+        : distribution(distribution) {}
+
+    __forceinline__ __host__ __device__
+    unsigned short operator()(const unsigned int v)
+    {
+        return Format::from_float(distribution(v));
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_COMMON_H_
@@ -22,12 +22,15 @@
 #define ROCRAND_RNG_DISTRIBUTION_DISCRETE_H_
 
 #include <climits>
+#include <cmath>
 #include <algorithm>
 #include <vector>
 
 #include <rocrand.h>
 
 #include "device_distributions.hpp"
+#include "discrete_builder.hpp"
+#include "../memory_pool.hpp"
 
 // Alias method
 //
@@ -41,7 +44,11 @@ enum rocrand_discrete_method
 {
     ROCRAND_DISCRETE_METHOD_ALIAS = 1,
     ROCRAND_DISCRETE_METHOD_CDF = 2,
-    ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF
+    // Alias table with 8-byte entries (32-bit fixed-point threshold and alias),
+    // opt-in: values may differ from the double table near thresholds
+    ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT = 4,
+    ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF,
+    ROCRAND_DISCRETE_METHOD_UNIVERSAL_COMPACT = ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT | ROCRAND_DISCRETE_METHOD_CDF
 };
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
@@ -54,7 +61,10 @@ public:
         size = 0;
         probability = NULL;
         alias = NULL;
+        compact_alias = NULL;
         cdf = NULL;
+        guide_size = 0;
+        guide = NULL;
     }
 
     rocrand_discrete_distribution_base(const double * probabilities,
@@ -70,50 +80,60 @@ public:
     __host__ __device__
     ~rocrand_discrete_distribution_base() { }
 
-    void deallocate()
+    void deallocate(hipStream_t stream = 0)
     {
         // Explicit deallocation is used because on HCC the object is copied
         // multiple times inside hipLaunchKernelGGL, and destructor is called
         // for all copies (we can't use c++ smart pointers for device pointers)
         if (IsHostSide)
         {
-            if (probability != NULL)
-            {
-                delete[] probability;
-            }
-            if (alias != NULL)
-            {
-                delete[] alias;
-            }
-            if (cdf != NULL)
-            {
-                delete[] cdf;
-            }
+            rocrand_host::detail::host_pool_free(probability);
+            rocrand_host::detail::host_pool_free(alias);
+            rocrand_host::detail::host_pool_free(compact_alias);
+            rocrand_host::detail::host_pool_free(cdf);
+            rocrand_host::detail::host_pool_free(guide);
         }
         else
         {
-            if (probability != NULL)
-            {
-                hipFree(probability);
-            }
-            if (alias != NULL)
-            {
-                hipFree(alias);
-            }
-            if (cdf != NULL)
-            {
-                hipFree(cdf);
-            }
+            // Tables are reused only by work on stream ordered after
+            // the last work which uses them
+            rocrand_host::detail::pool_free(probability, stream);
+            rocrand_host::detail::pool_free(alias, stream);
+            rocrand_host::detail::pool_free(compact_alias, stream);
+            rocrand_host::detail::pool_free(cdf, stream);
+            rocrand_host::detail::pool_free(guide, stream);
         }
         probability = NULL;
         alias = NULL;
+        compact_alias = NULL;
         cdf = NULL;
+        guide = NULL;
+    }
+
+    // Returns the number of bytes used by the tables
+    size_t memory_size() const
+    {
+        size_t bytes = 0;
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            bytes += (sizeof(double) + sizeof(unsigned int)) * size;
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT) != 0)
+        {
+            bytes += sizeof(unsigned long long) * size;
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            bytes += sizeof(double) * size;
+            bytes += sizeof(unsigned int) * (guide_size + 1);
+        }
+        return bytes;
     }
 
     __forceinline__ __host__ __device__
     unsigned int operator()(const unsigned int x) const
     {
-        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        if ((Method & (ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT)) != 0)
         {
             return rocrand_device::detail::discrete_alias(x, *this);
         }
@@ -125,38 +145,47 @@ public:
 
 protected:
 
+    // Tables are allocated and filled in stream order, the host does not
+    // wait for the device
     void init(std::vector<double> p,
               const unsigned int size,
-              const unsigned int offset)
+              const unsigned int offset,
+              hipStream_t stream = 0)
     {
         this->size = size;
         this->offset = offset;
 
-        deallocate();
-        allocate();
+        deallocate(stream);
+        guide_size = get_guide_size(size);
+        allocate(stream);
         normalize(p);
-        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        if ((Method & (ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT)) != 0)
         {
-            create_alias_table(p);
+            create_alias_table(p, stream);
         }
         if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
         {
-            create_cdf(p);
+            create_cdf(p, stream);
         }
     }
 
-    void allocate()
+    void allocate(hipStream_t stream)
     {
         if (IsHostSide)
         {
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                probability = new double[size];
-                alias = new unsigned int[size];
+                probability = rocrand_host::detail::host_pool_malloc<double>(size);
+                alias = rocrand_host::detail::host_pool_malloc<unsigned int>(size);
+            }
+            if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT) != 0)
+            {
+                compact_alias = rocrand_host::detail::host_pool_malloc<unsigned long long>(size);
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                cdf = new double[size];
+                cdf = rocrand_host::detail::host_pool_malloc<double>(size);
+                guide = rocrand_host::detail::host_pool_malloc<unsigned int>(guide_size + 1);
             }
         }
         else
@@ -164,12 +193,20 @@ protected:
             hipError_t error;
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                error = hipMalloc(&probability, sizeof(double) * size);
+                error = rocrand_host::detail::pool_malloc(&probability, sizeof(double) * size, stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
-                error = hipMalloc(&alias, sizeof(unsigned int) * size);
+                error = rocrand_host::detail::pool_malloc(&alias, sizeof(unsigned int) * size, stream);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+            }
+            if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT) != 0)
+            {
+                error = rocrand_host::detail::pool_malloc(&compact_alias, sizeof(unsigned long long) * size, stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -177,7 +214,12 @@ protected:
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                error = hipMalloc(&cdf, sizeof(double) * size);
+                error = rocrand_host::detail::pool_malloc(&cdf, sizeof(double) * size, stream);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                error = rocrand_host::detail::pool_malloc(&guide, sizeof(unsigned int) * (guide_size + 1), stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -189,9 +231,16 @@ protected:
     void normalize(std::vector<double>& p)
     {
         double sum = 0.0;
-        for (int i = 0; i < size; i++)
+        if (size >= rocrand_host::detail::discrete_parallel_threshold)
         {
-            sum += p[i];
+            sum = rocrand_host::detail::discrete_parallel_sum(p.data(), size);
+        }
+        else
+        {
+            for (int i = 0; i < size; i++)
+            {
+                sum += p[i];
+            }
         }
         // Normalize probabilities
         for (int i = 0; i < size; i++)
@@ -200,11 +249,83 @@ protected:
         }
     }
 
-    void create_alias_table(std::vector<double> p)
+    void create_alias_table(std::vector<double> p, hipStream_t stream)
     {
         std::vector<double> h_probability(size);
         std::vector<unsigned int> h_alias(size);
 
+        if (size >= rocrand_host::detail::discrete_parallel_threshold)
+        {
+            // Large tables are built on all host threads
+            rocrand_host::detail::discrete_parallel_alias_table(
+                p.data(), size, h_probability.data(), h_alias.data()
+            );
+        }
+        else
+        {
+            create_alias_table_vose(p, h_probability, h_alias);
+        }
+
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            copy_to_table(probability, h_probability, stream);
+            copy_to_table(alias, h_alias, stream);
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS_COMPACT) != 0)
+        {
+            std::vector<unsigned long long> h_compact_alias(size);
+            for (unsigned int i = 0; i < size; i++)
+            {
+                // Round the threshold to 32-bit fixed-point, items that
+                // are always accepted are their own aliases
+                const double threshold = std::floor(h_probability[i] * 4294967296.0 + 0.5);
+                unsigned long long entry;
+                if (threshold >= 4294967296.0)
+                {
+                    entry = 0xFFFFFFFFULL | (static_cast<unsigned long long>(i) << 32);
+                }
+                else
+                {
+                    entry = static_cast<unsigned long long>(threshold)
+                        | (static_cast<unsigned long long>(h_alias[i]) << 32);
+                }
+                h_compact_alias[i] = entry;
+            }
+            copy_to_table(compact_alias, h_compact_alias, stream);
+        }
+    }
+
+    template<class T>
+    void copy_to_table(T * table, const std::vector<T>& values, hipStream_t stream)
+    {
+        if (IsHostSide)
+        {
+            std::copy(values.begin(), values.end(), table);
+        }
+        else
+        {
+            // Values are uploaded from pinned staging memory on stream, so
+            // the host does not wait for the copy. The table is a new or
+            // pooled block freed on stream: kernels which use the previous
+            // contents are ordered before the copy.
+            rocrand_host::detail::staging_pool& staging =
+                rocrand_host::detail::staging_pool::instance();
+            T * buffer = static_cast<T *>(staging.acquire(sizeof(T) * values.size()));
+            std::copy(values.begin(), values.end(), buffer);
+            hipError_t error;
+            error = hipMemcpyAsync(table, buffer, sizeof(T) * values.size(), hipMemcpyHostToDevice, stream);
+            staging.release(buffer, stream);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+    }
+
+    void create_alias_table_vose(std::vector<double>& p,
+                                 std::vector<double>& h_probability,
+                                 std::vector<unsigned int>& h_alias)
+    {
         const double average = 1.0 / size;
 
         // For detailed descrition of Vose's algorithm see
@@ -254,52 +375,54 @@ protected:
         {
             h_probability[i] = 1.0;
         }
+    }
 
-        if (IsHostSide)
+    void create_cdf(std::vector<double> p, hipStream_t stream)
+    {
+        std::vector<double> h_cdf(size);
+
+        if (size >= rocrand_host::detail::discrete_parallel_threshold)
         {
-            std::copy(h_probability.begin(), h_probability.end(), probability);
-            std::copy(h_alias.begin(), h_alias.end(), alias);
+            rocrand_host::detail::discrete_parallel_cdf(p.data(), size, h_cdf.data());
         }
         else
         {
-            hipError_t error;
-            error = hipMemcpy(probability, h_probability.data(), sizeof(double) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
+            double sum = 0.0;
+            for (int i = 0; i < size; i++)
             {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
+                sum += p[i];
+                h_cdf[i] = sum;
             }
-            error = hipMemcpy(alias, h_alias.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
+        }
+
+        // Guide table: the first index of each of guide_size equal buckets
+        // of [0, 1), the last entry bounds the search for x close to 1
+        std::vector<unsigned int> h_guide(guide_size + 1);
+        unsigned int i = 0;
+        for (unsigned int k = 0; k <= guide_size; k++)
+        {
+            const double x = static_cast<double>(k) / guide_size;
+            while (i < size - 1 && h_cdf[i] < x)
             {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
+                i++;
             }
+            h_guide[k] = i;
         }
+
+        copy_to_table(cdf, h_cdf, stream);
+        copy_to_table(guide, h_guide, stream);
     }
 
-    void create_cdf(std::vector<double> p)
+    static unsigned int get_guide_size(const unsigned int size)
     {
-        std::vector<double> h_cdf(size);
-
-        double sum = 0.0;
-        for (int i = 0; i < size; i++)
+        // The smallest power of 2 not less than size (one bucket per value
+        // on average), limited to keep the table small for huge distributions
+        unsigned int guide_size = 1;
+        while (guide_size < size && guide_size < (1u << 20))
         {
-            sum += p[i];
-            h_cdf[i] = sum;
-        }
-
-        if (IsHostSide)
-        {
-            std::copy(h_cdf.begin(), h_cdf.end(), cdf);
-        }
-        else
-        {
-            hipError_t error;
-            error = hipMemcpy(cdf, h_cdf.data(), sizeof(double) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
-            {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
-            }
+            guide_size <<= 1;
         }
+        return guide_size;
     }
 };
 
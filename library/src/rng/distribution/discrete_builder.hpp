@@ -0,0 +1,297 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_DISCRETE_BUILDER_H_
+#define ROCRAND_RNG_DISTRIBUTION_DISCRETE_BUILDER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// Parallel construction of alias tables and CDFs on host threads
+//
+// Hubschle-Schneider L., Sanders P.
+// Parallel Weighted Random Sampling, 2019
+//
+// Light (w < 1) and heavy (w >= 1) items are processed in index order by
+// the sweeping algorithm. The state of the sweep after any number of steps
+// depends only on how many light and heavy items were consumed, and the
+// decision which one is consumed next is a comparison of prefix sums of light
+// deficits and heavy excesses. Hence the sweep is a merge of two sorted
+// sequences and can be split between threads with merge path partitioning.
+
+namespace rocrand_host {
+namespace detail {
+
+// Tables with at least this many elements are built in parallel
+constexpr unsigned int discrete_parallel_threshold = 1 << 16;
+// Size of the work item processed by one thread at a time. Block boundaries
+// do not depend on the number of threads, so floating point results
+// (and hence the tables) are the same on every machine.
+constexpr size_t discrete_parallel_block = 1 << 14;
+
+inline size_t discrete_blocks(const size_t n)
+{
+    return (n + discrete_parallel_block - 1) / discrete_parallel_block;
+}
+
+// Calls f(block, begin, end) for all blocks of [0, n)
+template<class Function>
+inline void discrete_parallel_for(const size_t n, Function f)
+{
+    const size_t blocks = discrete_blocks(n);
+    const size_t threads = std::min<size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), blocks
+    );
+
+    std::atomic<size_t> next_block(0);
+    auto worker = [&]()
+    {
+        size_t block;
+        while((block = next_block.fetch_add(1)) < blocks)
+        {
+            const size_t begin = block * discrete_parallel_block;
+            f(block, begin, std::min(n, begin + discrete_parallel_block));
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for(size_t t = 1; t < threads; t++)
+    {
+        try
+        {
+            pool.emplace_back(worker);
+        }
+        catch(const std::system_error&)
+        {
+            // The remaining blocks are processed by fewer threads
+            break;
+        }
+    }
+    worker();
+    for(std::thread& thread : pool)
+    {
+        thread.join();
+    }
+}
+
+// Computes result[i] = value(0) + ... + value(i - 1) for i in [0, n],
+// returns the total sum
+template<class Function>
+inline double discrete_exclusive_scan(const size_t n, Function value, double * result)
+{
+    std::vector<double> block_sums(discrete_blocks(n) + 1, 0.0);
+    discrete_parallel_for(n,
+        [&](size_t block, size_t begin, size_t end)
+        {
+            double sum = 0.0;
+            for(size_t i = begin; i < end; i++)
+            {
+                sum += value(i);
+            }
+            block_sums[block + 1] = sum;
+        }
+    );
+    for(size_t block = 1; block < block_sums.size(); block++)
+    {
+        block_sums[block] += block_sums[block - 1];
+    }
+    discrete_parallel_for(n,
+        [&](size_t block, size_t begin, size_t end)
+        {
+            double sum = block_sums[block];
+            for(size_t i = begin; i < end; i++)
+            {
+                result[i] = sum;
+                sum += value(i);
+            }
+        }
+    );
+    result[n] = block_sums.back();
+    return block_sums.back();
+}
+
+inline double discrete_parallel_sum(const double * p, const size_t n)
+{
+    std::vector<double> block_sums(discrete_blocks(n), 0.0);
+    discrete_parallel_for(n,
+        [&](size_t block, size_t begin, size_t end)
+        {
+            double sum = 0.0;
+            for(size_t i = begin; i < end; i++)
+            {
+                sum += p[i];
+            }
+            block_sums[block] = sum;
+        }
+    );
+    double sum = 0.0;
+    for(double s : block_sums)
+    {
+        sum += s;
+    }
+    return sum;
+}
+
+// Computes the inclusive prefix sum of p
+inline void discrete_parallel_cdf(const double * p, const size_t n, double * cdf)
+{
+    std::vector<double> sums(n + 1);
+    discrete_exclusive_scan(n, [p](size_t i) { return p[i]; }, sums.data());
+    std::copy(sums.begin() + 1, sums.end(), cdf);
+}
+
+// Builds the alias table for normalized probabilities p
+inline void discrete_parallel_alias_table(const double * p,
+                                          const unsigned int size,
+                                          double * probability,
+                                          unsigned int * alias)
+{
+    std::vector<double> w(size);
+    std::vector<size_t> block_lights(discrete_blocks(size) + 1, 0);
+    discrete_parallel_for(size,
+        [&](size_t block, size_t begin, size_t end)
+        {
+            size_t lights = 0;
+            for(size_t i = begin; i < end; i++)
+            {
+                w[i] = p[i] * size;
+                lights += w[i] < 1.0 ? 1 : 0;
+            }
+            block_lights[block + 1] = lights;
+        }
+    );
+    for(size_t block = 1; block < block_lights.size(); block++)
+    {
+        block_lights[block] += block_lights[block - 1];
+    }
+
+    // Stable partition into light and heavy items
+    const size_t lights_count = block_lights.back();
+    const size_t heavies_count = size - lights_count;
+    std::vector<unsigned int> lights(lights_count);
+    std::vector<unsigned int> heavies(heavies_count);
+    discrete_parallel_for(size,
+        [&](size_t block, size_t begin, size_t end)
+        {
+            size_t l = block_lights[block];
+            size_t h = begin - l;
+            for(size_t i = begin; i < end; i++)
+            {
+                if(w[i] < 1.0)
+                    lights[l++] = i;
+                else
+                    heavies[h++] = i;
+            }
+        }
+    );
+
+    if(heavies_count == 0)
+    {
+        // All weights are 1 up to rounding errors
+        for(unsigned int i = 0; i < size; i++)
+        {
+            probability[i] = 1.0;
+            alias[i] = i;
+        }
+        return;
+    }
+
+    // Total deficit of the first i light items and total excess of
+    // the first j heavy items
+    std::vector<double> light_sums(lights_count + 1);
+    std::vector<double> heavy_sums(heavies_count + 1);
+    discrete_exclusive_scan(lights_count,
+        [&](size_t i) { return 1.0 - w[lights[i]]; },
+        light_sums.data()
+    );
+    discrete_exclusive_scan(heavies_count,
+        [&](size_t j) { return w[heavies[j]] - 1.0; },
+        heavy_sums.data()
+    );
+
+    // When i light and j heavy items have been consumed the current heavy item
+    // has weight w[heavies[j]] - (light_sums[i] - heavy_sums[j]) left,
+    // it stays heavy while light_sums[i] < heavy_sums[j + 1].
+    // The last heavy item takes whatever is left.
+    auto heavy_key = [&](size_t j)
+    {
+        return j + 1 < heavies_count
+            ? heavy_sums[j + 1]
+            : std::numeric_limits<double>::infinity();
+    };
+
+    discrete_parallel_for(lights_count + heavies_count,
+        [&](size_t, size_t begin, size_t end)
+        {
+            // Find the state of the sweep after begin steps (merge path)
+            size_t low = begin > heavies_count ? begin - heavies_count : 0;
+            size_t high = std::min(begin, lights_count);
+            while(low < high)
+            {
+                const size_t mid = (low + high) / 2;
+                if(light_sums[mid] < heavy_key(begin - mid - 1))
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            size_t i = low;
+            size_t j = begin - low;
+
+            for(size_t step = begin; step < end; step++)
+            {
+                if(i < lights_count && light_sums[i] < heavy_key(j))
+                {
+                    // The current heavy item fills the bucket of the light item
+                    const unsigned int less = lights[i];
+                    probability[less] = w[less];
+                    alias[less] = heavies[j];
+                    i++;
+                }
+                else
+                {
+                    // The current heavy item has become light, its bucket
+                    // is filled by the next heavy item
+                    const unsigned int more = heavies[j];
+                    if(j + 1 < heavies_count)
+                    {
+                        const double left = w[more] - (light_sums[i] - heavy_sums[j]);
+                        probability[more] = std::min(1.0, std::max(0.0, left));
+                        alias[more] = heavies[j + 1];
+                    }
+                    else
+                    {
+                        probability[more] = 1.0;
+                        alias[more] = more;
+                    }
+                    j++;
+                }
+            }
+        }
+    );
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_DISCRETE_BUILDER_H_
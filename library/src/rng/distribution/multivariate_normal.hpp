@@ -0,0 +1,253 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "normal.hpp"
+
+// Generates correlated normal vectors y = mean + L * z, where z are independent
+// standard normal values and L is a lower-triangular factor of the covariance
+// matrix (for example, its Cholesky factor).
+//
+// Output is dimension-blocked: value d of vector i is stored at data[d * n + i],
+// so consecutive threads write consecutive addresses.
+//
+// Factors of at most MaxDimensions (8, 16, 32 or 64) dimensions are cached in
+// shared memory of MaxDimensions * (MaxDimensions + 1) / 2 values, a thread keeps
+// z of its vector in registers (loops over MaxDimensions are unrolled) and writes
+// every y once. MaxDimensions = 0 supports any dimension, see the specialization.
+template<class NormalDistribution = normal_distribution<float>, unsigned int MaxDimensions = 0>
+struct multivariate_normal_distribution
+{
+    static_assert(MaxDimensions % 2 == 0 && MaxDimensions <= 64,
+                  "MaxDimensions must be even and at most 64");
+
+    static const unsigned int max_dimensions = MaxDimensions;
+    static const unsigned int shared_factor_size =
+        MaxDimensions * (MaxDimensions + 1) / 2;
+
+    // At most MaxDimensions
+    unsigned int dimensions;
+    // Device pointer to dimensions values or NULL (zero mean)
+    const float * mean;
+    // Device pointer to dimensions x dimensions row-major matrix,
+    // the upper triangle is not used
+    const float * factor;
+
+    __host__ __device__
+    multivariate_normal_distribution(unsigned int dimensions,
+                                     const float * mean,
+                                     const float * factor)
+        : dimensions(dimensions), mean(mean), factor(factor) {}
+
+    // Copies the lower triangle of the factor to shared memory packed by rows,
+    // must be called by all threads of the block
+    __forceinline__ __device__
+    void load(float * shared_factor) const
+    {
+        for(unsigned int i = hipThreadIdx_x; i < dimensions * dimensions; i += hipBlockDim_x)
+        {
+            const unsigned int row = i / dimensions;
+            const unsigned int col = i % dimensions;
+            if(col <= row)
+                shared_factor[row * (row + 1) / 2 + col] = factor[i];
+        }
+        __syncthreads();
+    }
+
+    // Stores y computed from z of one vector with the given stride
+    __forceinline__ __host__ __device__
+    void store(const float * z, float * data, const size_t stride,
+               const float * shared_factor) const
+    {
+        #pragma unroll
+        for(unsigned int r = 0; r < MaxDimensions; r++)
+        {
+            if(r < dimensions)
+            {
+                const float * row = shared_factor + r * (r + 1) / 2;
+                float y = mean == NULL ? 0.0f : mean[r];
+                #pragma unroll
+                for(unsigned int k = 0; k <= r; k++)
+                {
+                    y += row[k] * z[k];
+                }
+                data[r * stride] = y;
+            }
+        }
+    }
+
+    // Skips values of one vector, used by engines that are shared by all threads
+    // of a block when a thread has no vector to generate
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void discard(Engine& engine) const
+    {
+        for(unsigned int d = 0; d < dimensions; d += 2)
+        {
+            engine();
+            engine();
+        }
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void operator()(Engine& engine, float * data, const size_t stride,
+                    const float * shared_factor) const
+    {
+        NormalDistribution distribution;
+        float z[MaxDimensions];
+        #pragma unroll
+        for(unsigned int d = 0; d < MaxDimensions; d += 2)
+        {
+            if(d < dimensions)
+            {
+                const unsigned int x = engine();
+                const unsigned int y = engine();
+                const float2 v = distribution(x, y);
+                z[d] = v.x;
+                z[d + 1] = v.y;
+            }
+        }
+        store(z, data, stride, shared_factor);
+    }
+};
+
+// Any dimension: the factor is read from global memory. A thread stores z of its
+// vector to the output and then replaces it with y in place: y[d] depends only
+// on z[0..d], hence rows are processed from the last one to the first one and
+// no separate buffer is needed.
+template<class NormalDistribution>
+struct multivariate_normal_distribution<NormalDistribution, 0>
+{
+    static const unsigned int max_dimensions = 0;
+    // Not used
+    static const unsigned int shared_factor_size = 1;
+
+    unsigned int dimensions;
+    // Device pointer to dimensions values or NULL (zero mean)
+    const float * mean;
+    // Device pointer to dimensions x dimensions row-major matrix,
+    // the upper triangle is not used
+    const float * factor;
+
+    __host__ __device__
+    multivariate_normal_distribution(unsigned int dimensions,
+                                     const float * mean,
+                                     const float * factor)
+        : dimensions(dimensions), mean(mean), factor(factor) {}
+
+    __forceinline__ __device__
+    void load(float * shared_factor) const
+    {
+        (void)shared_factor;
+    }
+
+    // Replaces z stored with the given stride by y
+    __forceinline__ __host__ __device__
+    void transform(float * data, const size_t stride) const
+    {
+        for(unsigned int r = dimensions; r-- > 0; )
+        {
+            const float * row = factor + r * dimensions;
+            float y = mean == NULL ? 0.0f : mean[r];
+            for(unsigned int k = 0; k <= r; k++)
+            {
+                y += row[k] * data[k * stride];
+            }
+            data[r * stride] = y;
+        }
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void discard(Engine& engine) const
+    {
+        for(unsigned int d = 0; d < dimensions; d += 2)
+        {
+            engine();
+            engine();
+        }
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void operator()(Engine& engine, float * data, const size_t stride,
+                    const float * shared_factor) const
+    {
+        (void)shared_factor;
+        NormalDistribution distribution;
+        for(unsigned int d = 0; d < dimensions; d += 2)
+        {
+            const unsigned int x = engine();
+            const unsigned int y = engine();
+            const float2 v = distribution(x, y);
+            data[d * stride] = v.x;
+            if(d + 1 < dimensions)
+                data[(d + 1) * stride] = v.y;
+        }
+        transform(data, stride);
+    }
+};
+
+namespace rocrand_host {
+namespace detail {
+
+// Calls generator.generate_multivariate_normal(data, n_vectors, distribution)
+// with the smallest distribution that supports dimensions
+template<class NormalDistribution, class Generator>
+rocrand_status dispatch_multivariate_normal(Generator& generator,
+                                            float * data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const float * mean, const float * factor)
+{
+    if(dimensions <= 8)
+    {
+        return generator.generate_multivariate_normal(data, n_vectors,
+            multivariate_normal_distribution<NormalDistribution, 8>(dimensions, mean, factor));
+    }
+    if(dimensions <= 16)
+    {
+        return generator.generate_multivariate_normal(data, n_vectors,
+            multivariate_normal_distribution<NormalDistribution, 16>(dimensions, mean, factor));
+    }
+    if(dimensions <= 32)
+    {
+        return generator.generate_multivariate_normal(data, n_vectors,
+            multivariate_normal_distribution<NormalDistribution, 32>(dimensions, mean, factor));
+    }
+    if(dimensions <= 64)
+    {
+        return generator.generate_multivariate_normal(data, n_vectors,
+            multivariate_normal_distribution<NormalDistribution, 64>(dimensions, mean, factor));
+    }
+    return generator.generate_multivariate_normal(data, n_vectors,
+        multivariate_normal_distribution<NormalDistribution>(dimensions, mean, factor));
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
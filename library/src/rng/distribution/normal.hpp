@@ -26,6 +26,7 @@
 
 #include "common.hpp"
 #include "device_distributions.hpp"
+#include "uniform.hpp"
 
 template<class T>
 struct normal_distribution;
@@ -106,6 +107,58 @@ struct normal_distribution<double>
     }
 };
 
+// Returns two normally distributed 16-bit floating point values packed into
+// one unsigned integer (the low 16 bits give the first value).
+// The pair is computed by NormalDistribution from two full 32-bit values of
+// the engine and only the results are narrowed to Format, so the radius of
+// Box-Muller transform has the same tails as float normal values.
+template<class Format, class NormalDistribution>
+struct normal_distribution_16
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution_16(float mean = 0.0f, float stddev = 1.0f) :
+                           mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int x, const unsigned int y) const
+    {
+        NormalDistribution distribution(mean, stddev);
+        const float2 v = distribution(x, y);
+        return Format::from_float(v.x) | (static_cast<unsigned int>(Format::from_float(v.y)) << 16);
+    }
+
+    // Engine returns 32-bit values, 2 values are used
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    unsigned int operator()(Engine& engine) const
+    {
+        const unsigned int x = engine();
+        const unsigned int y = engine();
+        return (*this)(x, y);
+    }
+};
+
+template<>
+struct normal_distribution<half_format>
+    : normal_distribution_16<half_format, normal_distribution<float> >
+{
+    __host__ __device__
+    normal_distribution<half_format>(float mean = 0.0f, float stddev = 1.0f) :
+        normal_distribution_16<half_format, normal_distribution<float> >(mean, stddev) {}
+};
+
+template<>
+struct normal_distribution<bfloat16_format>
+    : normal_distribution_16<bfloat16_format, normal_distribution<float> >
+{
+    __host__ __device__
+    normal_distribution<bfloat16_format>(float mean = 0.0f, float stddev = 1.0f) :
+        normal_distribution_16<bfloat16_format, normal_distribution<float> >(mean, stddev) {}
+};
+
 template<class T>
 struct mrg_normal_distribution;
 
@@ -149,4 +202,23 @@ struct mrg_normal_distribution<double>
     }
 };
 
+// Two packed 16-bit values, see normal_distribution_16
+template<>
+struct mrg_normal_distribution<half_format>
+    : normal_distribution_16<half_format, mrg_normal_distribution<float> >
+{
+    __host__ __device__
+    mrg_normal_distribution<half_format>(float mean = 0.0f, float stddev = 1.0f) :
+        normal_distribution_16<half_format, mrg_normal_distribution<float> >(mean, stddev) {}
+};
+
+template<>
+struct mrg_normal_distribution<bfloat16_format>
+    : normal_distribution_16<bfloat16_format, mrg_normal_distribution<float> >
+{
+    __host__ __device__
+    mrg_normal_distribution<bfloat16_format>(float mean = 0.0f, float stddev = 1.0f) :
+        normal_distribution_16<bfloat16_format, mrg_normal_distribution<float> >(mean, stddev) {}
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_H_
@@ -0,0 +1,237 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_PERMUTATION_H_
+#define ROCRAND_RNG_DISTRIBUTION_PERMUTATION_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "../memory_pool.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    __global__
+    void permutation_kernel(unsigned int * data, const size_t k,
+                            const unsigned long long n,
+                            const unsigned int * keys,
+                            const unsigned int half_bits)
+    {
+        // Keys are the same for all threads
+        __shared__ unsigned int shared_keys[ROCRAND_PERMUTATION_ROUNDS];
+        if(hipThreadIdx_x < ROCRAND_PERMUTATION_ROUNDS)
+        {
+            shared_keys[hipThreadIdx_x] = keys[hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        while(index < k)
+        {
+            data[index] = rocrand_device::detail::permute(index, n, shared_keys, half_bits);
+            index += stride;
+        }
+    }
+
+    // Values of each dimension are (p(i) + 1 - u) / n, where p is a random
+    // permutation of strata [0, n) and u is the uniform jitter in (0, 1]
+    // already stored in data. They are computed in double, so the jitter
+    // is not lost for large strata, and then kept inside [p(i) / n, (p(i) + 1) / n)
+    // after rounding to float (n <= 2^24, so every stratum has a float value).
+    __global__
+    void latin_hypercube_kernel(float * data, const size_t n,
+                                const unsigned int dimensions,
+                                const unsigned int * keys,
+                                const unsigned int half_bits)
+    {
+        __shared__ unsigned int shared_keys[ROCRAND_PERMUTATION_ROUNDS];
+
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int dimension = hipBlockIdx_y; dimension < dimensions; dimension += hipGridDim_y)
+        {
+            // Each dimension has its own permutation
+            __syncthreads();
+            if(hipThreadIdx_x < ROCRAND_PERMUTATION_ROUNDS)
+            {
+                shared_keys[hipThreadIdx_x] =
+                    keys[dimension * ROCRAND_PERMUTATION_ROUNDS + hipThreadIdx_x];
+            }
+            __syncthreads();
+
+            float * values = data + dimension * n;
+            size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            while(index < n)
+            {
+                const unsigned int stratum =
+                    rocrand_device::detail::permute(index, n, shared_keys, half_bits);
+                const double lower = static_cast<double>(stratum) / n;
+                const double upper = static_cast<double>(stratum + 1) / n;
+                float value = static_cast<float>(
+                    (static_cast<double>(stratum + 1) - values[index]) / n
+                );
+                if(value < lower)
+                    value = nextafterf(value, 1.0f);
+                if(value >= upper)
+                    value = nextafterf(value, 0.0f);
+                values[index] = value;
+                index += stride;
+            }
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Generates the first k elements of random permutations of [0, n) and
+// Latin hypercube samples.
+//
+// Round keys of every permutation are generated by the generator itself into
+// device memory, so no synchronization with the host is needed and
+// the generator's sequence advances as usual.
+class permutation_manager
+{
+public:
+
+    permutation_manager()
+        : keys(NULL), keys_size(0), stream(0)
+    { }
+
+    permutation_manager(const permutation_manager&) = delete;
+    permutation_manager& operator=(const permutation_manager&) = delete;
+
+    ~permutation_manager()
+    {
+        rocrand_host::detail::pool_free(keys, stream);
+    }
+
+    template<class Generator>
+    rocrand_status generate(Generator& generator,
+                            unsigned int * data, size_t k, unsigned long long n,
+                            hipStream_t stream)
+    {
+        if(k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_status status = generate_keys(generator, 1, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const unsigned int threads = 256;
+        const unsigned int max_blocks = 4096;
+        const unsigned int blocks = static_cast<unsigned int>(
+            std::min<size_t>(max_blocks, (k + threads - 1) / threads)
+        );
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::permutation_kernel),
+            dim3(blocks), dim3(threads), 0, stream,
+            data, k, n, keys, rocrand_device::detail::permutation_half_bits(n)
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Generates dimensions x n values (dimension-major): each dimension
+    // has exactly one value in every stratum [i / n, (i + 1) / n].
+    // Strata are permuted by Feistel networks instead of sorting keys,
+    // so the cost is linear in the number of values.
+    template<class Generator>
+    rocrand_status generate_latin_hypercube(Generator& generator,
+                                            float * data, size_t n,
+                                            unsigned int dimensions,
+                                            hipStream_t stream)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Jitter inside strata
+        rocrand_status status = generator.generate_uniform(data, n * dimensions);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = generate_keys(generator, dimensions, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const unsigned int threads = 256;
+        const unsigned int max_blocks = 4096;
+        const unsigned int blocks_x = static_cast<unsigned int>(
+            std::min<size_t>(max_blocks, (n + threads - 1) / threads)
+        );
+        const unsigned int blocks_y = std::min(
+            std::max(1u, max_blocks / blocks_x), dimensions
+        );
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::latin_hypercube_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, stream,
+            data, n, dimensions, keys, rocrand_device::detail::permutation_half_bits(n)
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+
+    // Generates round keys of count permutations
+    template<class Generator>
+    rocrand_status generate_keys(Generator& generator, const size_t count,
+                                 hipStream_t new_stream)
+    {
+        const hipStream_t last_stream = stream;
+        stream = new_stream;
+        const size_t size = count * ROCRAND_PERMUTATION_ROUNDS;
+        if(size > keys_size)
+        {
+            if(keys != NULL)
+            {
+                rocrand_host::detail::pool_free(keys, last_stream);
+                keys_size = 0;
+            }
+            hipError_t error = rocrand_host::detail::pool_malloc(&keys, sizeof(unsigned int) * size, stream);
+            if(error != hipSuccess)
+            {
+                keys = NULL;
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            keys_size = size;
+        }
+        return generator.generate_uniform(keys, size);
+    }
+
+    unsigned int * keys;
+    size_t keys_size;
+    // Stream of the last work which uses keys
+    hipStream_t stream;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_PERMUTATION_H_
@@ -23,6 +23,7 @@
 
 #include <climits>
 #include <algorithm>
+#include <list>
 #include <vector>
 
 #include <rocrand.h>
@@ -48,7 +49,7 @@ public:
     __host__ __device__
     ~rocrand_poisson_distribution() { }
 
-    void set_lambda(double lambda)
+    void set_lambda(double lambda, hipStream_t stream = 0)
     {
         const size_t capacity =
             2 * static_cast<size_t>(16.0 * (2.0 + std::sqrt(lambda)));
@@ -56,7 +57,7 @@ public:
 
         calculate_probabilities(p, capacity, lambda);
 
-        this->init(p, this->size, this->offset);
+        this->init(p, this->size, this->offset, stream);
     }
 
 protected:
@@ -110,37 +111,266 @@ protected:
 };
 
 // Handles caching of precomputed tables for the distribution and recomputes
-// them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// them only when lambda is not in the cache (as these computations, device
+// memory allocations and copying take time).
+//
+// Tables for several lambdas are kept, the least recently used ones are
+// evicted when the number of tables or their total memory size exceeds
+// the limits.
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
 public:
 
-    rocrand_poisson_distribution<Method, IsHostSide> dis;
+    typedef rocrand_poisson_distribution<Method, IsHostSide> distribution_type;
+
+    static constexpr unsigned int default_max_tables = 8;
+    // 0 means no limit
+    static constexpr size_t default_max_bytes = 64 * 1024 * 1024;
+
+    // Distribution for the lambda passed to the last set_lambda() call
+    distribution_type dis;
 
     poisson_distribution_manager()
-        : lambda(0.0)
+        : max_tables(default_max_tables), max_bytes(default_max_bytes),
+          used_bytes(0), hits(0), misses(0), stream(0)
     { }
 
     ~poisson_distribution_manager()
     {
-        dis.deallocate();
+        clear();
+    }
+
+    // The tables are used on stream until the next call
+    void set_lambda(double new_lambda, hipStream_t new_stream = 0)
+    {
+        stream = new_stream;
+        dis = acquire(new_lambda);
+        // Only the new current table is pinned, the previous one can be evicted now
+        for (entry& e : entries)
+        {
+            e.current = false;
+        }
+        entries.front().current = true;
+        evict();
+    }
+
+    // Builds and caches tables for lambda without changing the current one,
+    // the current table is never evicted by it
+    void prewarm(double lambda)
+    {
+        acquire(lambda);
+    }
+
+    void set_limits(unsigned int new_max_tables, size_t new_max_bytes)
+    {
+        max_tables = new_max_tables;
+        max_bytes = new_max_bytes;
+        evict();
+    }
+
+    unsigned long long get_hits() const
+    {
+        return hits;
+    }
+
+    unsigned long long get_misses() const
+    {
+        return misses;
     }
 
-    void set_lambda(double new_lambda)
+    // Frees all cached tables
+    void clear()
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
+        for (entry& e : entries)
         {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
+            e.dis.deallocate(stream);
         }
+        entries.clear();
+        used_bytes = 0;
+        dis = distribution_type();
     }
 
 private:
 
-    double lambda;
+    struct entry
+    {
+        double lambda;
+        distribution_type dis;
+        size_t bytes;
+        // dis is the current distribution, it is not evicted
+        bool current;
+    };
+
+    distribution_type acquire(double lambda)
+    {
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if (it->lambda == lambda)
+            {
+                hits++;
+                // Move to the front (most recently used)
+                entries.splice(entries.begin(), entries, it);
+                return entries.front().dis;
+            }
+        }
+
+        misses++;
+        entry e;
+        e.lambda = lambda;
+        try
+        {
+            e.dis.set_lambda(lambda, stream);
+        }
+        catch(rocrand_status status)
+        {
+            e.dis.deallocate(stream);
+            throw;
+        }
+        e.bytes = e.dis.memory_size();
+        e.current = false;
+        entries.push_front(e);
+        used_bytes += e.bytes;
+        evict();
+        return entries.front().dis;
+    }
+
+    void evict()
+    {
+        // The most recently used table and the current table are always
+        // kept, even if they do not fit into the limits
+        auto it = entries.end();
+        while (it != entries.begin()
+            && (entries.size() > max_tables
+                || (max_bytes > 0 && used_bytes > max_bytes)))
+        {
+            --it;
+            if (it == entries.begin() || it->current)
+            {
+                continue;
+            }
+            used_bytes -= it->bytes;
+            it->dis.deallocate(stream);
+            it = entries.erase(it);
+        }
+    }
+
+    // Most recently used tables first
+    std::list<entry> entries;
+
+    unsigned int max_tables;
+    size_t max_bytes;
+    size_t used_bytes;
+
+    unsigned long long hits;
+    unsigned long long misses;
+
+    // Stream passed to the last set_lambda() call, the last work which uses
+    // the tables is on it (generators synchronize when their stream changes)
+    hipStream_t stream;
+};
+
+// Adapts a device engine to the state interface used by Poisson samplers
+// from rocrand_poisson.h (rocrand_uniform_double() and rocrand_normal_double()
+// below are found via ADL), so the samplers can be used with a separate lambda
+// for every generated value, without any precomputed tables.
+//
+// Engine must return a uniformly distributed 32-bit value on each call.
+template<class Engine>
+struct poisson_engine_state
+{
+    Engine& engine;
+
+    __forceinline__ __host__ __device__
+    poisson_engine_state(Engine& engine) : engine(engine) {}
+
+    __forceinline__ __host__ __device__
+    double uniform_double()
+    {
+        const unsigned int v1 = engine();
+        const unsigned int v2 = engine();
+        return rocrand_device::detail::uniform_distribution_double(v1, v2);
+    }
+};
+
+// MRG32K3A returns values from [1, ROCRAND_MRG32K3A_M1]
+template<>
+struct poisson_engine_state< ::rocrand_device::mrg32k3a_engine>
+{
+    ::rocrand_device::mrg32k3a_engine& engine;
+
+    __forceinline__ __host__ __device__
+    poisson_engine_state(::rocrand_device::mrg32k3a_engine& engine) : engine(engine) {}
+
+    __forceinline__ __host__ __device__
+    double uniform_double()
+    {
+        return rocrand_device::detail::mrg_uniform_distribution_double(engine());
+    }
+};
+
+template<class Engine>
+__forceinline__ __host__ __device__
+double rocrand_uniform_double(poisson_engine_state<Engine> * state)
+{
+    return state->uniform_double();
+}
+
+template<class Engine>
+__forceinline__ __host__ __device__
+double rocrand_normal_double(poisson_engine_state<Engine> * state)
+{
+    const double x = state->uniform_double();
+    const double y = state->uniform_double();
+    return rocrand_device::detail::mrg_box_muller_double(x, y).x;
+}
+
+// State which holds exactly one 32-bit value. It is used with inversion-based
+// Poisson sampler (poisson_distribution_inv) which consumes one value per
+// sample, as required by quasi-random generators and MTGP32 (all threads of
+// a block must draw values together).
+struct poisson_value_state
+{
+    const unsigned int value;
+
+    __forceinline__ __host__ __device__
+    poisson_value_state(const unsigned int value) : value(value) {}
+};
+
+__forceinline__ __host__ __device__
+double rocrand_uniform_double(poisson_value_state * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(state->value);
+}
+
+__forceinline__ __host__ __device__
+double rocrand_normal_double(poisson_value_state * state)
+{
+    return rocrand_device::detail::normal_distribution_double(state->value);
+}
+
+// Poisson distribution with a separate lambda for every value
+struct poisson_array_distribution
+{
+    // Rejection/approximation methods, the number of values
+    // consumed from the engine is variable
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    unsigned int operator()(Engine& engine, const double lambda) const
+    {
+        poisson_engine_state<Engine> state(engine);
+        poisson_engine_state<Engine> * state_ptr = &state;
+        return rocrand_device::detail::poisson_distribution(state_ptr, lambda);
+    }
+
+    // Inversion method, consumes exactly one value
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int x, const double lambda) const
+    {
+        poisson_value_state state(x);
+        poisson_value_state * state_ptr = &state;
+        return rocrand_device::detail::poisson_distribution_inv(state_ptr, lambda);
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_POISSON_H_
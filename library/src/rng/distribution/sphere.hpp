@@ -0,0 +1,182 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_SPHERE_H_
+#define ROCRAND_RNG_DISTRIBUTION_SPHERE_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "uniform.hpp"
+#include "normal.hpp"
+
+enum sphere_shape
+{
+    // Unit vectors (surface of the unit sphere)
+    SPHERE_SHAPE_SPHERE,
+    // Points inside of the unit ball
+    SPHERE_SHAPE_BALL,
+    // Points with non-negative coordinates that sum up to 1
+    SPHERE_SHAPE_SIMPLEX
+};
+
+// Uniformly distributed points on spheres, in balls and on simplices.
+// Values of each point are stored contiguously.
+//
+// Every point uses the same number of engine values (see values()), so engines
+// shared by all threads of a block stay in lockstep.
+template<class UniformDistribution = uniform_distribution<float>,
+         class NormalDistribution = normal_distribution<float> >
+struct sphere_distribution
+{
+    sphere_shape shape;
+    unsigned int dimensions;
+
+    __host__ __device__
+    sphere_distribution(sphere_shape shape, unsigned int dimensions)
+        : shape(shape), dimensions(dimensions) {}
+
+    __forceinline__ __host__ __device__
+    static float2 unit_circle(const float u)
+    {
+        float2 result;
+        const float angle = ROCRAND_2PI * u;
+        #ifdef __HIP_DEVICE_COMPILE__
+            __sincosf(angle, &result.x, &result.y);
+        #else
+            result.x = sinf(angle);
+            result.y = cosf(angle);
+        #endif
+        return result;
+    }
+
+    // Number of engine values used for one point
+    __forceinline__ __host__ __device__
+    unsigned int values() const
+    {
+        if(shape == SPHERE_SHAPE_SIMPLEX)
+            return dimensions;
+        const unsigned int radius_values = shape == SPHERE_SHAPE_BALL ? 1 : 0;
+        if(dimensions <= 3)
+            return dimensions - 1 + radius_values + (dimensions == 1 ? 1 : 0);
+        return (dimensions + 1) / 2 * 2 + radius_values;
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void operator()(Engine& engine, float * data) const
+    {
+        UniformDistribution uniform;
+        if(shape == SPHERE_SHAPE_SIMPLEX)
+        {
+            // Normalized exponentially distributed values (flat Dirichlet)
+            float sum = 0.0f;
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                const float e = -logf(uniform(engine()));
+                data[d] = e;
+                sum += e;
+            }
+            // sum is 0 only if all values are 1.0f
+            const float scale = sum > 0.0f ? 1.0f / sum : 0.0f;
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                data[d] = sum > 0.0f ? data[d] * scale : 1.0f / dimensions;
+            }
+            return;
+        }
+
+        float radius = 1.0f;
+        if(dimensions == 1)
+        {
+            // -1 or 1
+            data[0] = (engine() & 1) ? 1.0f : -1.0f;
+        }
+        else if(dimensions == 2)
+        {
+            // The angle of the Box-Muller transform
+            const float2 v = unit_circle(uniform(engine()));
+            data[0] = v.x;
+            data[1] = v.y;
+        }
+        else if(dimensions == 3)
+        {
+            // Archimedes: z is uniform in [-1, 1]
+            const float z = 2.0f * uniform(engine()) - 1.0f;
+            const float2 v = unit_circle(uniform(engine()));
+            const float r = sqrtf(fmaxf(0.0f, 1.0f - z * z));
+            data[0] = r * v.x;
+            data[1] = r * v.y;
+            data[2] = z;
+        }
+        else
+        {
+            // Normalized vectors of normally distributed values
+            NormalDistribution normal;
+            float sum = 0.0f;
+            for(unsigned int d = 0; d < dimensions; d += 2)
+            {
+                const unsigned int x = engine();
+                const unsigned int y = engine();
+                const float2 v = normal(x, y);
+                data[d] = v.x;
+                sum += v.x * v.x;
+                if(d + 1 < dimensions)
+                {
+                    data[d + 1] = v.y;
+                    sum += v.y * v.y;
+                }
+            }
+            radius = sum > 0.0f ? 1.0f / sqrtf(sum) : 0.0f;
+        }
+
+        if(shape == SPHERE_SHAPE_BALL)
+        {
+            // Volume of the ball of radius r is proportional to r^dimensions
+            const float u = uniform(engine());
+            radius *= dimensions == 1 ? u
+                : dimensions == 2 ? sqrtf(u)
+                : dimensions == 3 ? cbrtf(u)
+                : powf(u, 1.0f / dimensions);
+        }
+        if(radius != 1.0f)
+        {
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                data[d] *= radius;
+            }
+        }
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    void discard(Engine& engine) const
+    {
+        const unsigned int n = values();
+        for(unsigned int i = 0; i < n; i++)
+        {
+            engine();
+        }
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_SPHERE_H_
@@ -0,0 +1,79 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "uniform.hpp"
+
+// Normal distribution truncated to [lower, upper]. Tail intervals use
+// rejection sampling, so the number of engine values used for one result
+// is not fixed.
+template<class T, class UniformDistribution = uniform_distribution<T> >
+struct truncated_normal_distribution
+{
+    rocrand_device::detail::truncated_normal_params<T> params;
+
+    __host__ __device__
+    truncated_normal_distribution(T mean, T stddev, T lower, T upper)
+        : params(mean, stddev, lower, upper) {}
+
+    // Inverse CDF for all intervals, used by quasi-random generators
+    __forceinline__ __host__ __device__
+    T operator()(const unsigned int x) const
+    {
+        UniformDistribution uniform;
+        return params.inverse_cdf(uniform(x));
+    }
+
+    // One attempt, returns false if the proposal is rejected.
+    // Every attempt uses the same number of engine values, so engines shared
+    // by all threads of a block can stay in lockstep.
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    bool attempt(Engine& engine, T& result) const
+    {
+        UniformDistribution uniform;
+        if(params.method == rocrand_device::detail::TRUNCATED_NORMAL_INVERSE_CDF)
+        {
+            result = params.inverse_cdf(uniform(engine()));
+            return true;
+        }
+        const T u1 = uniform(engine());
+        const T u2 = uniform(engine());
+        return params.rejection(u1, u2, result);
+    }
+
+    template<class Engine>
+    __forceinline__ __host__ __device__
+    T operator()(Engine& engine) const
+    {
+        T result;
+        while(!attempt(engine, result)) { }
+        return result;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
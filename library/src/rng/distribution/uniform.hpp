@@ -113,6 +113,47 @@ struct uniform_distribution<double>
     }
 };
 
+// For unsigned integer between 0 and UINT_MAX, returns two 16-bit floating
+// point values between 0 and 1, excluding 0 and including 1, packed into
+// one unsigned integer (the low 16 bits of v give the first value).
+// (v16 + 1) / 2^16 is exact in float, it is rounded up to the precision of
+// Format (not to nearest), so every value gets all inputs of the interval
+// (previous value, value] and values of one binade are equally likely.
+template<class Format>
+struct uniform_distribution_16
+{
+    __forceinline__ __host__ __device__
+    unsigned short value(const unsigned int v16) const
+    {
+        const unsigned int mask = (1U << Format::dropped_bits) - 1;
+        const unsigned int f = rocrand_host::detail::float_as_uint((v16 + 1) * (1.0f / 65536.0f));
+        return Format::from_float(rocrand_host::detail::uint_as_float((f + mask) & ~mask));
+    }
+
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return value(v & 0xFFFF) | (static_cast<unsigned int>(value(v >> 16)) << 16);
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 v) const
+    {
+        return uint4 {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct uniform_distribution<half_format> : uniform_distribution_16<half_format> { };
+
+template<>
+struct uniform_distribution<bfloat16_format> : uniform_distribution_16<bfloat16_format> { };
+
 // MRG32K3A constants
 #ifndef ROCRAND_MRG32K3A_NORM_DOUBLE
 #define ROCRAND_MRG32K3A_NORM_DOUBLE (2.3283065498378288e-10) // 1/ROCRAND_MRG32K3A_M1
@@ -158,4 +199,21 @@ struct mrg_uniform_distribution<double>
     }
 };
 
+// Two packed 16-bit values, see uniform_distribution_16
+template<class Format>
+struct mrg_uniform_distribution_16
+{
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return uniform_distribution_16<Format>()(mrg_uniform_distribution<unsigned int>()(v));
+    }
+};
+
+template<>
+struct mrg_uniform_distribution<half_format> : mrg_uniform_distribution_16<half_format> { };
+
+template<>
+struct mrg_uniform_distribution<bfloat16_format> : mrg_uniform_distribution_16<bfloat16_format> { };
+
 #endif // ROCRAND_RNG_DISTRIBUTION_UNIFORM_H_
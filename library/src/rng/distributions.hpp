@@ -24,7 +24,13 @@
 #include "distribution/uniform.hpp"
 #include "distribution/normal.hpp"
 #include "distribution/log_normal.hpp"
+#include "distribution/truncated_normal.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/bernoulli.hpp"
+#include "distribution/multivariate_normal.hpp"
+#include "distribution/permutation.hpp"
+#include "distribution/sphere.hpp"
+#include "distribution/brownian_bridge.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
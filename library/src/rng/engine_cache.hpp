@@ -0,0 +1,167 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ENGINE_CACHE_H_
+#define ROCRAND_RNG_ENGINE_CACHE_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "engine_storage.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Copies of engine arrays initialized for recently used (seed, offset) pairs.
+// Restoring engines is a device-to-device copy, which is much cheaper than
+// running init_engines_kernel (jump-ahead) again when an application
+// alternates between a few seeds or offsets.
+//
+// The cache is disabled (capacity is 0) by default because every entry
+// takes as much device memory as the engines of the generator.
+template<class Engine>
+class engine_cache
+{
+public:
+    engine_cache() : m_capacity(0) { }
+
+    ~engine_cache()
+    {
+        set_capacity(0);
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    // Sets the maximum number of cached arrays, the least recently used
+    // arrays are released when there are too many of them
+    void set_capacity(const size_t capacity)
+    {
+        m_capacity = capacity;
+        while(m_entries.size() > m_capacity)
+        {
+            pool_free(m_entries.back().engines.data, m_entries.back().stream);
+            m_entries.pop_back();
+        }
+    }
+
+    // Copies engines initialized with seed and offset to engines (at most
+    // engines.stride of them), returns the number of copied engines
+    // (0 if they are not cached)
+    size_t load(const soa_engines<Engine>& engines,
+                const unsigned long long seed, const unsigned long long offset,
+                hipStream_t stream)
+    {
+        for(size_t i = 0; i < m_entries.size(); i++)
+        {
+            entry& e = m_entries[i];
+            if(e.seed == seed && e.offset == offset)
+            {
+                e.stream = stream;
+                const size_t size = std::min(e.size, engines.stride);
+                if(copy_engines(engines, e.engines, size, stream) != hipSuccess)
+                {
+                    return 0;
+                }
+                // Move to the front (most recently used)
+                std::rotate(m_entries.begin(), m_entries.begin() + i, m_entries.begin() + i + 1);
+                return size;
+            }
+        }
+        return 0;
+    }
+
+    // Saves a copy of engines initialized with seed and offset, replaces
+    // previously saved engines of seed and offset.
+    // Failures are not errors, the engines are just not cached.
+    void store(const soa_engines<Engine>& engines, const size_t size,
+               const unsigned long long seed, const unsigned long long offset,
+               hipStream_t stream)
+    {
+        if(m_capacity == 0)
+            return;
+
+        // The entry which is replaced: the same seed and offset or
+        // the least recently used one
+        size_t replaced = m_entries.size();
+        for(size_t i = 0; i < m_entries.size(); i++)
+        {
+            if(m_entries[i].seed == seed && m_entries[i].offset == offset)
+            {
+                replaced = i;
+            }
+        }
+        if(replaced == m_entries.size() && m_entries.size() == m_capacity)
+        {
+            replaced = m_entries.size() - 1;
+        }
+
+        entry e = { seed, offset, size, { NULL, 0 }, stream };
+        if(replaced < m_entries.size())
+        {
+            // Reuse memory of the replaced entry
+            const entry& r = m_entries[replaced];
+            if(r.engines.stride == size && r.stream == stream)
+            {
+                e.engines = r.engines;
+            }
+            else
+            {
+                pool_free(r.engines.data, r.stream);
+            }
+            m_entries.erase(m_entries.begin() + replaced);
+        }
+        if(e.engines.data == NULL &&
+           allocate_engines(e.engines, size, stream) != ROCRAND_STATUS_SUCCESS)
+        {
+            return;
+        }
+        if(copy_engines(e.engines, engines, size, stream) != hipSuccess)
+        {
+            pool_free(e.engines.data, stream);
+            return;
+        }
+        m_entries.insert(m_entries.begin(), e);
+    }
+
+private:
+    struct entry
+    {
+        unsigned long long seed;
+        unsigned long long offset;
+        size_t size;
+        soa_engines<Engine> engines;
+        // Stream of the last copy from or to the entry
+        hipStream_t stream;
+    };
+
+    size_t m_capacity;
+    // The most recently used entries are first
+    std::vector<entry> m_entries;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ENGINE_CACHE_H_
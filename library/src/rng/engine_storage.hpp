@@ -0,0 +1,217 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ENGINE_STORAGE_H_
+#define ROCRAND_RNG_ENGINE_STORAGE_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "memory_pool.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Number of blocks launched by generators for size work items (values,
+// vectors, words etc.). Generation kernels use grid-stride loops, when every
+// thread processes at most one work item the stride does not matter, so
+// small requests are done by fewer blocks and produce the same values as
+// max_blocks blocks. Only engines of these blocks must be allocated and
+// initialized.
+inline unsigned int generator_blocks(const size_t size,
+                                     const unsigned int threads,
+                                     const unsigned int max_blocks)
+{
+    return static_cast<unsigned int>(
+        std::min<size_t>(max_blocks, size / threads + 1)
+    );
+}
+
+// Maximum number of blocks for ROCRAND_ORDERING_PSEUDO_BEST: as many blocks
+// as can be resident on the current device at once, so generation kernels
+// fill the device with one wave of blocks and no more engines than needed
+// are initialized. default_blocks is used if the device can't be queried.
+inline unsigned int device_blocks(const unsigned int threads,
+                                  const unsigned int default_blocks)
+{
+    int device;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipGetDeviceProperties(&props, device) != hipSuccess)
+    {
+        return default_blocks;
+    }
+    const unsigned int blocks_per_cu =
+        std::max<unsigned int>(props.maxThreadsPerMultiProcessor / threads, 1);
+    return std::max<unsigned int>(props.multiProcessorCount * blocks_per_cu, 1);
+}
+
+// Seed of engine engine_id for ROCRAND_ORDERING_PSEUDO_SEEDED, engines are
+// seeded independently instead of skipping engine_id subsequences.
+// SplitMix64 of the seed and the engine id.
+__forceinline__ __device__ __host__
+unsigned long long seeded_engine_seed(const unsigned long long seed,
+                                      const unsigned int engine_id)
+{
+    unsigned long long z = seed + 0x9E3779B97F4A7C15ULL * (engine_id + 1ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Grows engines to at least size engines (but not more than max_size),
+// the first initialized_size engines are preserved.
+// Engines are allocated lazily on the first use and grow geometrically
+// so generators which produce only a few values use little memory.
+template<class Engine>
+inline rocrand_status grow_engines(Engine *& engines,
+                                   size_t& engines_size,
+                                   const size_t size,
+                                   const size_t max_size,
+                                   const size_t initialized_size,
+                                   hipStream_t stream)
+{
+    if(size <= engines_size)
+        return ROCRAND_STATUS_SUCCESS;
+
+    const size_t new_size = std::min(max_size, std::max(size, 2 * engines_size));
+    Engine * new_engines;
+    if(pool_malloc(&new_engines, sizeof(Engine) * new_size, stream) != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    if(initialized_size > 0 &&
+       hipMemcpyAsync(new_engines, engines, sizeof(Engine) * initialized_size,
+                      hipMemcpyDeviceToDevice, stream) != hipSuccess)
+    {
+        pool_free(new_engines, stream);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    // The old array is reused only by work ordered after the copy
+    pool_free(engines, stream);
+    engines = new_engines;
+    engines_size = new_size;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Engines stored as a structure of arrays: word i of engine j is
+// data[i * stride + j]. Neighbouring threads load and store neighbouring
+// words, so accesses to states are coalesced on device and contiguous
+// on host.
+// Engines must consist of 32-bit words (no Box-Muller state).
+template<class Engine>
+struct soa_engines
+{
+    static_assert(sizeof(Engine) % sizeof(unsigned int) == 0
+                  && alignof(Engine) <= alignof(unsigned int),
+                  "Engine must consist of 32-bit words");
+    static constexpr unsigned int words = sizeof(Engine) / sizeof(unsigned int);
+
+    unsigned int * data;
+    // Maximum number of engines
+    size_t stride;
+
+    __forceinline__ __device__ __host__
+    Engine load(const unsigned int engine_id) const
+    {
+        unsigned int w[words];
+        for(unsigned int i = 0; i < words; i++)
+        {
+            w[i] = data[i * stride + engine_id];
+        }
+        return *reinterpret_cast<const Engine *>(w);
+    }
+
+    __forceinline__ __device__ __host__
+    void store(const unsigned int engine_id, const Engine& engine) const
+    {
+        const unsigned int * w = reinterpret_cast<const unsigned int *>(&engine);
+        for(unsigned int i = 0; i < words; i++)
+        {
+            data[i * stride + engine_id] = w[i];
+        }
+    }
+};
+
+template<class Engine>
+inline rocrand_status allocate_engines(soa_engines<Engine>& engines,
+                                       const size_t size,
+                                       hipStream_t stream)
+{
+    engines.stride = size;
+    if(pool_malloc(&engines.data, sizeof(unsigned int) * soa_engines<Engine>::words * size, stream) != hipSuccess)
+    {
+        engines.data = NULL;
+        engines.stride = 0;
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Copies the first size engines
+template<class Engine>
+inline hipError_t copy_engines(const soa_engines<Engine>& dst,
+                               const soa_engines<Engine>& src,
+                               const size_t size,
+                               hipStream_t stream)
+{
+    return hipMemcpy2DAsync(
+        dst.data, sizeof(unsigned int) * dst.stride,
+        src.data, sizeof(unsigned int) * src.stride,
+        sizeof(unsigned int) * size, soa_engines<Engine>::words,
+        hipMemcpyDeviceToDevice, stream
+    );
+}
+
+// Grows engines to at least size engines, see grow_engines above
+template<class Engine>
+inline rocrand_status grow_engines(soa_engines<Engine>& engines,
+                                   const size_t size,
+                                   const size_t max_size,
+                                   const size_t initialized_size,
+                                   hipStream_t stream)
+{
+    if(size <= engines.stride)
+        return ROCRAND_STATUS_SUCCESS;
+
+    soa_engines<Engine> new_engines;
+    rocrand_status status = allocate_engines(
+        new_engines, std::min(max_size, std::max(size, 2 * engines.stride)), stream
+    );
+    if(status != ROCRAND_STATUS_SUCCESS)
+        return status;
+    if(initialized_size > 0 &&
+       copy_engines(new_engines, engines, initialized_size, stream) != hipSuccess)
+    {
+        pool_free(new_engines.data, stream);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    // The old array is reused only by work ordered after the copy
+    pool_free(engines.data, stream);
+    engines = new_engines;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ENGINE_STORAGE_H_
@@ -24,12 +24,16 @@
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
+#include "memory_pool.hpp"
+
 struct rocrand_generator_base_type
 {
     rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
     const rocrand_rng_type rng_type;
 
     virtual ~rocrand_generator_base_type() {}
+
+    virtual hipStream_t get_stream() const = 0;
 };
 
 // rocRAND random number generator base class
@@ -42,7 +46,10 @@ struct rocrand_generator_type : public rocrand_generator_base_type
                            unsigned long long offset = 0,
                            hipStream_t stream = 0)
         : base_type(GeneratorType),
-          m_seed(seed), m_offset(offset), m_stream(stream)
+          m_seed(seed), m_offset(offset), m_stream(stream),
+          m_order(GeneratorType == ROCRAND_RNG_QUASI_SOBOL32
+                  ? ROCRAND_ORDERING_QUASI_DEFAULT
+                  : ROCRAND_ORDERING_PSEUDO_DEFAULT)
     {
 
     }
@@ -68,8 +75,19 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         return m_stream;
     }
 
+    rocrand_ordering get_order() const
+    {
+        return m_order;
+    }
+
     void set_stream(hipStream_t stream)
     {
+        // Memory owned by the generator is returned to the pool on m_stream,
+        // so the new stream must be ordered after work on the previous one
+        if(rocrand_host::detail::pool_change_stream(m_stream, stream) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
         m_stream = stream;
     }
 
@@ -78,6 +96,7 @@ protected:
     unsigned long long m_seed;
     unsigned long long m_offset;
     hipStream_t m_stream;
+    rocrand_ordering m_order;
 };
 
 #endif // ROCRAND_RNG_GENERATOR_TYPE_H_
@@ -27,4 +27,6 @@
 #include "sobol32.hpp"
 #include "mtgp32.hpp"
 
+#include "prefetcher.hpp"
+
 #endif // ROCRAND_RNG_GENERATORS_H_
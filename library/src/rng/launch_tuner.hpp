@@ -0,0 +1,775 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LAUNCH_TUNER_H_
+#define ROCRAND_RNG_LAUNCH_TUNER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "distributions.hpp"
+#include "output.hpp"
+
+// Autotuning of launch geometry
+//
+// The number of threads of a launch (together with the sequence of requests)
+// defines the values produced by a generator, but the grouping of threads into
+// blocks does not: work of a thread depends only on its global id and
+// the total number of threads. Hence a kernel can be launched with any block
+// size which divides the number of threads of the default launch (and is
+// a multiple of ThreadsPerEngine of Philox) and the output stays the same.
+//
+// The best block size depends on the device, the kernel (generator,
+// distribution and output type) and the size of the request:
+// * ROCRAND_TUNING_AUTOTUNE: launches of a kernel and size class
+//   (floor(log2(size))) which is not tuned yet use candidate block sizes in
+//   turn, their times are measured with events. When all candidates are
+//   measured the fastest one is used by next launches and stored in the cache.
+// * ROCRAND_TUNING_CACHED (default): tuned block sizes are used, nothing is
+//   measured.
+// * ROCRAND_TUNING_DEFAULT: default block sizes of generators are used.
+//
+// The cache file (ROCRAND_TUNING_CACHE environment variable or
+// rocrand_set_tuning_cache()) is loaded when the first generator is created.
+// Entries are keyed by the device name and the number of compute units and
+// the file is ignored when it was written by another version of rocRAND.
+//
+// Launches read the mode and an immutable snapshot of tuned block sizes
+// without locking, the mutex is taken only while kernels are measured and
+// the first time a device is used. The file is read and written outside
+// of the mutex.
+
+namespace rocrand_host {
+namespace detail {
+
+// Stable names of output types and distributions in keys of the cache
+// (type_info names differ between compilers). Every type used by a tuned
+// launch must have a name.
+template<class T>
+struct launch_name;
+
+#define ROCRAND_LAUNCH_NAME(type, name) \
+    template<> \
+    struct launch_name<type> \
+    { \
+        static std::string get() { return name; } \
+    };
+
+ROCRAND_LAUNCH_NAME(unsigned char, "u8")
+ROCRAND_LAUNCH_NAME(unsigned short, "u16")
+ROCRAND_LAUNCH_NAME(unsigned int, "u32")
+ROCRAND_LAUNCH_NAME(unsigned long long, "u64")
+ROCRAND_LAUNCH_NAME(float, "f32")
+ROCRAND_LAUNCH_NAME(double, "f64")
+ROCRAND_LAUNCH_NAME(half_format, "half")
+ROCRAND_LAUNCH_NAME(bfloat16_format, "bfloat16")
+ROCRAND_LAUNCH_NAME(poisson_array_distribution, "poisson_array")
+
+#undef ROCRAND_LAUNCH_NAME
+
+template<class T>
+struct launch_name<T *>
+{
+    static std::string get() { return launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<strided_output<T> >
+{
+    static std::string get() { return "strided_" + launch_name<T>::get(); }
+};
+
+// Uniform and normal distributions of MRG32k3a have the same names,
+// the generator is a part of the key
+template<class T>
+struct launch_name<uniform_distribution<T> >
+{
+    static std::string get() { return "uniform_" + launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<mrg_uniform_distribution<T> >
+{
+    static std::string get() { return "uniform_" + launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<normal_distribution<T> >
+{
+    static std::string get() { return "normal_" + launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<mrg_normal_distribution<T> >
+{
+    static std::string get() { return "normal_" + launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<log_normal_distribution<T> >
+{
+    static std::string get() { return "log_normal_" + launch_name<T>::get(); }
+};
+
+template<class T>
+struct launch_name<mrg_log_normal_distribution<T> >
+{
+    static std::string get() { return "log_normal_" + launch_name<T>::get(); }
+};
+
+template<class T, class UniformDistribution>
+struct launch_name<truncated_normal_distribution<T, UniformDistribution> >
+{
+    static std::string get() { return "truncated_normal_" + launch_name<T>::get(); }
+};
+
+template<class Format, class Distribution>
+struct launch_name<float16_distribution<Format, Distribution> >
+{
+    static std::string get()
+    {
+        return launch_name<Distribution>::get() + "_" + launch_name<Format>::get();
+    }
+};
+
+template<class UniformDistribution>
+struct launch_name<bernoulli_bits_distribution<UniformDistribution> >
+{
+    static std::string get() { return "bernoulli_bits"; }
+};
+
+// Kernels for small factors are tuned separately
+template<class NormalDistribution, unsigned int MaxDimensions>
+struct launch_name<multivariate_normal_distribution<NormalDistribution, MaxDimensions> >
+{
+    static std::string get()
+    {
+        std::ostringstream s;
+        s << "multivariate_normal";
+        if(MaxDimensions > 0)
+            s << "_" << MaxDimensions;
+        return s.str();
+    }
+};
+
+template<class UniformDistribution, class NormalDistribution>
+struct launch_name<sphere_distribution<UniformDistribution, NormalDistribution> >
+{
+    static std::string get() { return "sphere"; }
+};
+
+template<rocrand_discrete_method Method, bool IsHostSide>
+struct launch_name<rocrand_poisson_distribution<Method, IsHostSide> >
+{
+    static std::string get() { return "poisson"; }
+};
+
+class launch_tuner
+{
+public:
+
+    static constexpr unsigned int candidates_count = 5;
+    // Measured launches of each candidate, the best time is used
+    static constexpr unsigned int samples = 3;
+
+    // Result of select(), measured when candidate < candidates_count
+    struct measurement
+    {
+        std::string key;
+        unsigned int candidate;
+        size_t size;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    launch_tuner()
+        : m_mode(ROCRAND_TUNING_CACHED), m_loaded(false), m_version(0), m_saved_version(0),
+          m_snapshot(std::make_shared<const snapshot>())
+    {
+        const char * path = std::getenv("ROCRAND_TUNING_CACHE");
+        if(path != NULL)
+        {
+            m_path = path;
+        }
+    }
+
+    launch_tuner(const launch_tuner&) = delete;
+    launch_tuner& operator=(const launch_tuner&) = delete;
+
+    // The tuner is never destroyed, see memory_pool::instance()
+    static launch_tuner& instance()
+    {
+        static launch_tuner * tuner = new launch_tuner();
+        return *tuner;
+    }
+
+    static unsigned int candidate_threads(const unsigned int candidate)
+    {
+        return 64U << candidate;
+    }
+
+    rocrand_tuning_mode get_mode() const
+    {
+        return static_cast<rocrand_tuning_mode>(m_mode.load(std::memory_order_relaxed));
+    }
+
+    void set_mode(const rocrand_tuning_mode mode)
+    {
+        m_mode.store(mode, std::memory_order_relaxed);
+    }
+
+    // Sets the cache file and loads its entries, empty path disables the file
+    void set_path(const std::string& path)
+    {
+        const std::vector<std::string> lines = read_file(path);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_path = path;
+        m_loaded = true;
+        merge(lines);
+    }
+
+    // Loads the cache file if it has not been loaded yet
+    void load()
+    {
+        if(m_loaded.load())
+            return;
+
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            path = m_path;
+        }
+        const std::vector<std::string> lines = read_file(path);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_loaded && path == m_path)
+        {
+            m_loaded = true;
+            merge(lines);
+        }
+    }
+
+    // Looks up the tuned block size of a call site without locking,
+    // threads is 0 when the kernel is not tuned. Returns false when
+    // the device has not been used yet, then select() must be called.
+    bool find(const std::string& site,
+              const int device,
+              const unsigned int size_class,
+              unsigned int& threads) const
+    {
+        const std::shared_ptr<const snapshot> s = std::atomic_load(&m_snapshot);
+        if(device < 0 || device >= static_cast<int>(s->devices.size()) || !s->devices[device])
+            return false;
+
+        threads = 0;
+        auto it = s->sites.find(site);
+        if(it != s->sites.end())
+        {
+            auto jt = it->second.find(std::make_pair(device, size_class));
+            if(jt != it->second.end())
+            {
+                threads = jt->second;
+            }
+        }
+        return true;
+    }
+
+    // Returns the block size for a launch of total_threads threads of a call
+    // site, when the launch is measured, the start event is recorded to stream
+    unsigned int select(const std::string& site,
+                        const int device,
+                        const unsigned int size_class,
+                        const size_t size,
+                        const unsigned int total_threads,
+                        const unsigned int default_threads,
+                        hipStream_t stream,
+                        measurement& m)
+    {
+        m.candidate = candidates_count;
+        std::string path;
+        std::string contents;
+        unsigned long long version = 0;
+        unsigned int threads = default_threads;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            poll();
+            threads = select_locked(site, device, size_class, size, total_threads, default_threads,
+                                    stream, m, path, contents, version);
+        }
+        if(version != 0)
+        {
+            write_file(path, contents, version);
+        }
+        return threads;
+    }
+
+    // Records the stop event of a measured launch
+    void finish(measurement& m, hipStream_t stream)
+    {
+        if(m.candidate == candidates_count)
+            return;
+
+        hipEventRecord(m.stop, stream);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(m);
+    }
+
+    // The measured candidate can't be launched (e.g. it requires too many
+    // resources), it is excluded
+    void discard(measurement& m)
+    {
+        if(m.candidate == candidates_count)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry& e = m_entries[m.key];
+        e.failed[m.candidate] = true;
+        e.pending[m.candidate]--;
+        hipEventDestroy(m.start);
+        hipEventDestroy(m.stop);
+    }
+
+private:
+
+    struct entry
+    {
+        entry()
+            : threads(0)
+        {
+            for(unsigned int c = 0; c < candidates_count; c++)
+            {
+                time[c] = 0.0f;
+                measured[c] = 0;
+                pending[c] = 0;
+                failed[c] = false;
+            }
+        }
+
+        // Tuned block size, 0 while the kernel is being tuned
+        unsigned int threads;
+        // The best time per item of candidates
+        float time[candidates_count];
+        unsigned int measured[candidates_count];
+        unsigned int pending[candidates_count];
+        bool failed[candidates_count];
+    };
+
+    // Tuned block sizes read by launches, replaced as a whole
+    struct snapshot
+    {
+        // Devices with known names, launches on other devices call select()
+        std::vector<bool> devices;
+        // Call site -> (device, size class) -> block size
+        std::map<std::string, std::map<std::pair<int, unsigned int>, unsigned int> > sites;
+    };
+
+    // select() with m_mutex locked, when a kernel is tuned the contents of
+    // the cache file are returned to be written after unlocking
+    unsigned int select_locked(const std::string& site,
+                               const int device,
+                               const unsigned int size_class,
+                               const size_t size,
+                               const unsigned int total_threads,
+                               const unsigned int default_threads,
+                               hipStream_t stream,
+                               measurement& m,
+                               std::string& path,
+                               std::string& contents,
+                               unsigned long long& version)
+    {
+        std::ostringstream s;
+        s << device_key(device) << '\t' << site << '\t' << size_class;
+        const std::string key = s.str();
+
+        auto it = m_entries.find(key);
+        if(it != m_entries.end() && it->second.threads != 0)
+        {
+            const unsigned int threads = it->second.threads;
+            return total_threads % threads == 0 ? threads : default_threads;
+        }
+        if(get_mode() != ROCRAND_TUNING_AUTOTUNE)
+        {
+            return default_threads;
+        }
+        if(it == m_entries.end())
+        {
+            it = m_entries.insert(std::make_pair(key, entry())).first;
+        }
+        entry& e = it->second;
+
+        // The candidate with the fewest samples, candidates are valid when
+        // they divide total_threads
+        unsigned int best = candidates_count;
+        unsigned int pending = 0;
+        for(unsigned int c = 0; c < candidates_count; c++)
+        {
+            pending += e.pending[c];
+            const unsigned int count = e.measured[c] + e.pending[c];
+            if(!e.failed[c] && total_threads % candidate_threads(c) == 0 && count < samples
+               && (best == candidates_count || count < e.measured[best] + e.pending[best]))
+            {
+                best = c;
+            }
+        }
+        if(best == candidates_count)
+        {
+            // All candidates are measured or being measured
+            if(pending == 0)
+            {
+                decide(e, default_threads);
+                publish();
+                if(!m_path.empty())
+                {
+                    path = m_path;
+                    contents = serialize();
+                    version = ++m_version;
+                }
+                return total_threads % e.threads == 0 ? e.threads : default_threads;
+            }
+            return default_threads;
+        }
+
+        if(hipEventCreate(&m.start) != hipSuccess)
+        {
+            return default_threads;
+        }
+        if(hipEventCreate(&m.stop) != hipSuccess)
+        {
+            hipEventDestroy(m.start);
+            return default_threads;
+        }
+        hipEventRecord(m.start, stream);
+        m.key = key;
+        m.candidate = best;
+        m.size = size;
+        e.pending[best]++;
+        return candidate_threads(best);
+    }
+
+    // Collects times of completed measurements
+    void poll()
+    {
+        auto it = m_pending.begin();
+        while(it != m_pending.end())
+        {
+            const hipError_t status = hipEventQuery(it->stop);
+            if(status == hipErrorNotReady)
+            {
+                ++it;
+                continue;
+            }
+
+            entry& e = m_entries[it->key];
+            float ms;
+            if(status == hipSuccess && hipEventElapsedTime(&ms, it->start, it->stop) == hipSuccess)
+            {
+                const float time = ms / std::max<size_t>(it->size, 1);
+                const unsigned int c = it->candidate;
+                e.time[c] = e.measured[c] == 0 ? time : std::min(e.time[c], time);
+                e.measured[c]++;
+            }
+            e.pending[it->candidate]--;
+            hipEventDestroy(it->start);
+            hipEventDestroy(it->stop);
+            it = m_pending.erase(it);
+        }
+    }
+
+    static void decide(entry& e, const unsigned int default_threads)
+    {
+        e.threads = default_threads;
+        float best_time = 0.0f;
+        for(unsigned int c = 0; c < candidates_count; c++)
+        {
+            if(!e.failed[c] && e.measured[c] > 0 && (best_time == 0.0f || e.time[c] < best_time))
+            {
+                e.threads = candidate_threads(c);
+                best_time = e.time[c];
+            }
+        }
+    }
+
+    // Name and the number of compute units of a device
+    const std::string& device_key(const int device)
+    {
+        if(device >= static_cast<int>(m_devices.size()))
+        {
+            m_devices.resize(device + 1);
+        }
+        if(m_devices[device].empty())
+        {
+            std::ostringstream s;
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, device) == hipSuccess)
+            {
+                s << props.name << " (" << props.multiProcessorCount << " CUs)";
+            }
+            else
+            {
+                s << "device " << device;
+            }
+            m_devices[device] = s.str();
+            publish();
+        }
+        return m_devices[device];
+    }
+
+    // Replaces the snapshot with tuned block sizes of known devices
+    void publish()
+    {
+        std::shared_ptr<snapshot> s = std::make_shared<snapshot>();
+        s->devices.resize(m_devices.size());
+        for(size_t d = 0; d < m_devices.size(); d++)
+        {
+            s->devices[d] = !m_devices[d].empty();
+        }
+        for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if(it->second.threads == 0)
+                continue;
+
+            // Key: device, call site and size class separated by tabs
+            const std::string& key = it->first;
+            const size_t first = key.find('\t');
+            const size_t last = key.rfind('\t');
+            if(first == std::string::npos || last <= first)
+                continue;
+            const std::string device = key.substr(0, first);
+            const std::string site = key.substr(first + 1, last - first - 1);
+            const unsigned int size_class = std::strtoul(key.c_str() + last + 1, NULL, 10);
+            for(size_t d = 0; d < m_devices.size(); d++)
+            {
+                if(m_devices[d] == device)
+                {
+                    s->sites[site][std::make_pair(static_cast<int>(d), size_class)] = it->second.threads;
+                }
+            }
+        }
+        std::atomic_store(&m_snapshot, std::shared_ptr<const snapshot>(s));
+    }
+
+    static std::string header()
+    {
+        std::ostringstream s;
+        s << "# rocRAND launch tuning cache " << ROCRAND_VERSION;
+        return s.str();
+    }
+
+    // Lines of entries of a cache file, empty when the file can't be read
+    // or was written by another version
+    static std::vector<std::string> read_file(const std::string& path)
+    {
+        std::vector<std::string> lines;
+        if(path.empty())
+            return lines;
+
+        std::ifstream in(path.c_str());
+        std::string line;
+        if(!std::getline(in, line) || line != header())
+            return lines;
+        while(std::getline(in, line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    // Entries: device, call site (generator, kernel, output and distribution)
+    // and size class, block size separated by tabs
+    void merge(const std::vector<std::string>& lines)
+    {
+        for(size_t i = 0; i < lines.size(); i++)
+        {
+            const std::string& line = lines[i];
+            const size_t tab = line.rfind('\t');
+            if(tab == std::string::npos)
+                continue;
+            const unsigned int threads = std::strtoul(line.c_str() + tab + 1, NULL, 10);
+            bool valid = false;
+            for(unsigned int c = 0; c < candidates_count; c++)
+            {
+                valid = valid || threads == candidate_threads(c);
+            }
+            if(valid)
+            {
+                m_entries[line.substr(0, tab)].threads = threads;
+            }
+        }
+        publish();
+    }
+
+    std::string serialize() const
+    {
+        std::ostringstream out;
+        out << header() << '\n';
+        for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if(it->second.threads != 0)
+            {
+                out << it->first << '\t' << it->second.threads << '\n';
+            }
+        }
+        return out.str();
+    }
+
+    // The file is replaced, it's not an error if it can't be written.
+    // Contents older than the last written ones are skipped.
+    void write_file(const std::string& path,
+                    const std::string& contents,
+                    const unsigned long long version)
+    {
+        std::lock_guard<std::mutex> lock(m_file_mutex);
+        if(version <= m_saved_version)
+            return;
+        m_saved_version = version;
+
+        const std::string temp_path = path + ".tmp";
+        {
+            std::ofstream out(temp_path.c_str());
+            if(!out)
+                return;
+            out << contents;
+        }
+        if(std::rename(temp_path.c_str(), path.c_str()) != 0)
+        {
+            std::remove(path.c_str());
+            std::rename(temp_path.c_str(), path.c_str());
+        }
+    }
+
+    std::mutex m_mutex;
+    std::atomic<int> m_mode;
+    std::string m_path;
+    std::atomic<bool> m_loaded;
+    std::vector<std::string> m_devices;
+    std::map<std::string, entry> m_entries;
+    std::list<measurement> m_pending;
+    // Versions of serialized contents, the file is written under m_file_mutex
+    unsigned long long m_version;
+    std::mutex m_file_mutex;
+    unsigned long long m_saved_version;
+    std::shared_ptr<const snapshot> m_snapshot;
+};
+
+// Identifies a call site in the cache: generator, kernel, output and
+// distribution
+template<class Output, class Distribution>
+inline std::string launch_site_key(const rocrand_rng_type rng_type, const char * kernel)
+{
+    typedef typename std::remove_cv<typename std::remove_reference<Distribution>::type>::type distribution_type;
+    std::ostringstream s;
+    s << rng_type << '\t' << kernel
+      << '\t' << launch_name<Output>::get()
+      << '\t' << launch_name<distribution_type>::get();
+    return s.str();
+}
+
+// floor(log2(size))
+inline unsigned int launch_size_class(size_t size)
+{
+    unsigned int size_class = 0;
+    while(size > 1)
+    {
+        size /= 2;
+        size_class++;
+    }
+    return size_class;
+}
+
+// Launches total_threads threads of a kernel, launch(blocks, threads) launches
+// blocks of threads threads (blocks * threads == total_threads).
+// default_threads is used when the kernel is not tuned, and when
+// a candidate block size can't be launched.
+template<class Output, class Distribution, class Launch>
+inline rocrand_status tuned_launch(const rocrand_rng_type rng_type,
+                                   const char * kernel,
+                                   const size_t size,
+                                   const unsigned int total_threads,
+                                   const unsigned int default_threads,
+                                   hipStream_t stream,
+                                   Launch launch)
+{
+    // Launch is a lambda, so every call site (with its generator and kernel)
+    // has its own instantiation and the key is built once
+    static const std::string site = launch_site_key<Output, Distribution>(rng_type, kernel);
+
+    launch_tuner& tuner = launch_tuner::instance();
+    const rocrand_tuning_mode mode = tuner.get_mode();
+    launch_tuner::measurement m;
+    m.candidate = launch_tuner::candidates_count;
+    unsigned int threads = default_threads;
+    if(mode != ROCRAND_TUNING_DEFAULT)
+    {
+        int device = 0;
+        hipGetDevice(&device);
+        const unsigned int size_class = launch_size_class(size);
+        unsigned int tuned;
+        if(tuner.find(site, device, size_class, tuned)
+           && (tuned != 0 || mode != ROCRAND_TUNING_AUTOTUNE))
+        {
+            if(tuned != 0 && total_threads % tuned == 0)
+            {
+                threads = tuned;
+            }
+        }
+        else
+        {
+            threads = tuner.select(site, device, size_class, size,
+                                   total_threads, default_threads, stream, m);
+        }
+    }
+
+    launch(total_threads / threads, threads);
+    if(hipPeekAtLastError() != hipSuccess)
+    {
+        tuner.discard(m);
+        if(threads == default_threads)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Clear the error and use the default block size
+        hipGetLastError();
+        launch(total_threads / default_threads, default_threads);
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    tuner.finish(m, stream);
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_LAUNCH_TUNER_H_
@@ -0,0 +1,404 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MEMORY_POOL_H_
+#define ROCRAND_RNG_MEMORY_POOL_H_
+
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+// Stream-ordered memory pool for all memory owned by rocRAND (engines,
+// distribution tables, direction vectors etc.)
+//
+// hipMalloc and hipFree synchronize with all work on the device, so creating
+// generators or changing Poisson lambda used to stall other streams.
+// Freed blocks are kept in the pool and reused by allocations on the same
+// stream without synchronization: all work which uses the old contents is
+// ordered before any work which uses the new ones. Blocks are released
+// (hipFree) only when the cached memory exceeds the limit, when an allocation
+// fails, or by rocrand_trim_memory().
+//
+// A pointer must be freed on the stream of the last work which uses it
+// (or when no work which uses it is in flight).
+
+namespace rocrand_host {
+namespace detail {
+
+// Device memory
+struct device_memory
+{
+    static hipError_t allocate(void ** ptr, size_t size)
+    {
+        return hipMalloc(ptr, size);
+    }
+
+    static hipError_t deallocate(void * ptr)
+    {
+        return hipFree(ptr);
+    }
+};
+
+// Host memory (host-side tables), the pool works as an arena
+struct host_memory
+{
+    static hipError_t allocate(void ** ptr, size_t size)
+    {
+        *ptr = std::malloc(size);
+        return *ptr != NULL ? hipSuccess : hipErrorMemoryAllocation;
+    }
+
+    static hipError_t deallocate(void * ptr)
+    {
+        std::free(ptr);
+        return hipSuccess;
+    }
+};
+
+template<class Memory>
+class memory_pool
+{
+public:
+
+    // Cached (free) memory is released when its size exceeds the limit
+    static constexpr size_t default_max_cached_bytes = 256 * 1024 * 1024;
+
+    memory_pool()
+        : m_max_cached_bytes(default_max_cached_bytes), m_cached_bytes(0)
+    { }
+
+    memory_pool(const memory_pool&) = delete;
+    memory_pool& operator=(const memory_pool&) = delete;
+
+    // The pool is never destroyed: memory can be freed by objects destroyed
+    // after static objects, and the runtime may be unloaded before them
+    static memory_pool& instance()
+    {
+        static memory_pool * pool = new memory_pool();
+        return *pool;
+    }
+
+    hipError_t allocate(void ** ptr, size_t size, hipStream_t stream)
+    {
+        size = round_size(size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // The smallest cached block of the stream which is not too large
+        auto best = m_free.end();
+        for(auto it = m_free.begin(); it != m_free.end(); ++it)
+        {
+            if(it->stream == stream && it->size >= size && it->size <= 2 * size
+               && (best == m_free.end() || it->size < best->size))
+            {
+                best = it;
+            }
+        }
+        if(best != m_free.end())
+        {
+            *ptr = best->ptr;
+            m_used[best->ptr] = best->size;
+            m_cached_bytes -= best->size;
+            m_free.erase(best);
+            return hipSuccess;
+        }
+
+        hipError_t error = Memory::allocate(ptr, size);
+        if(error != hipSuccess && !m_free.empty())
+        {
+            // Retry when all cached memory is released
+            release(0);
+            error = Memory::allocate(ptr, size);
+        }
+        if(error != hipSuccess)
+        {
+            *ptr = NULL;
+            return error;
+        }
+        m_used[*ptr] = size;
+        return hipSuccess;
+    }
+
+    hipError_t deallocate(void * ptr, hipStream_t stream)
+    {
+        if(ptr == NULL)
+            return hipSuccess;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_used.find(ptr);
+        if(it == m_used.end())
+        {
+            // Not allocated by the pool
+            return hipErrorInvalidValue;
+        }
+        const block b = { ptr, it->second, stream };
+        m_used.erase(it);
+
+        // The most recently freed blocks are first
+        m_free.push_front(b);
+        m_cached_bytes += b.size;
+        return release(m_max_cached_bytes);
+    }
+
+    // Sets the maximum size of cached memory, 0 disables caching
+    hipError_t set_max_cached_bytes(size_t max_cached_bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_cached_bytes = max_cached_bytes;
+        return release(m_max_cached_bytes);
+    }
+
+    // Releases all cached memory
+    hipError_t trim()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return release(0);
+    }
+
+    size_t get_cached_bytes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_cached_bytes;
+    }
+
+private:
+
+    struct block
+    {
+        void * ptr;
+        size_t size;
+        hipStream_t stream;
+    };
+
+    static size_t round_size(const size_t size)
+    {
+        const size_t granularity = 256;
+        return (std::max<size_t>(size, 1) + granularity - 1) / granularity * granularity;
+    }
+
+    // Releases the least recently freed blocks until cached memory
+    // does not exceed max_cached_bytes
+    hipError_t release(const size_t max_cached_bytes)
+    {
+        hipError_t result = hipSuccess;
+        while(m_cached_bytes > max_cached_bytes)
+        {
+            const block& b = m_free.back();
+            const hipError_t error = Memory::deallocate(b.ptr);
+            if(error != hipSuccess)
+            {
+                result = error;
+            }
+            m_cached_bytes -= b.size;
+            m_free.pop_back();
+        }
+        return result;
+    }
+
+    std::mutex m_mutex;
+    size_t m_max_cached_bytes;
+    size_t m_cached_bytes;
+    // Sizes of allocated blocks
+    std::map<void *, size_t> m_used;
+    std::list<block> m_free;
+};
+
+// Pinned host buffers for asynchronous host-to-device copies
+//
+// The host writes into a buffer before the copy is enqueued, so buffers
+// can't be reused in stream order. Instead an event is recorded after
+// the copy and the buffer is reused when the event has completed.
+// The host never waits for the device.
+class staging_pool
+{
+public:
+
+    staging_pool()
+        : m_max_cached_bytes(memory_pool<device_memory>::default_max_cached_bytes),
+          m_cached_bytes(0)
+    { }
+
+    staging_pool(const staging_pool&) = delete;
+    staging_pool& operator=(const staging_pool&) = delete;
+
+    // See memory_pool::instance()
+    static staging_pool& instance()
+    {
+        static staging_pool * pool = new staging_pool();
+        return *pool;
+    }
+
+    // Returns a buffer of at least size bytes
+    void * acquire(size_t size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for(auto it = m_free.begin(); it != m_free.end(); ++it)
+        {
+            if(it->size >= size && it->size <= 2 * size
+               && hipEventQuery(it->event) == hipSuccess)
+            {
+                const block b = *it;
+                m_free.erase(it);
+                m_cached_bytes -= b.size;
+                m_used[b.ptr] = b;
+                return b.ptr;
+            }
+        }
+
+        block b;
+        b.size = std::max<size_t>(size, 4096);
+        if(hipHostMalloc(&b.ptr, b.size, hipHostMallocDefault) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipEventCreateWithFlags(&b.event, hipEventDisableTiming) != hipSuccess)
+        {
+            hipHostFree(b.ptr);
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_used[b.ptr] = b;
+        return b.ptr;
+    }
+
+    // Releases ptr after all work enqueued to stream so far (copies from ptr)
+    void release(void * ptr, hipStream_t stream)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_used.find(ptr);
+        if(it == m_used.end())
+            return;
+        const block b = it->second;
+        m_used.erase(it);
+
+        hipEventRecord(b.event, stream);
+        m_free.push_front(b);
+        m_cached_bytes += b.size;
+        release_completed(m_max_cached_bytes);
+    }
+
+    void set_max_cached_bytes(size_t max_cached_bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_cached_bytes = max_cached_bytes;
+        release_completed(m_max_cached_bytes);
+    }
+
+    // Releases all buffers which are not used by copies in flight
+    void trim()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        release_completed(0);
+    }
+
+private:
+
+    struct block
+    {
+        void * ptr;
+        size_t size;
+        hipEvent_t event;
+    };
+
+    // Buffers of copies in flight are kept even if the limit is exceeded
+    void release_completed(const size_t max_cached_bytes)
+    {
+        auto it = m_free.end();
+        while(m_cached_bytes > max_cached_bytes && it != m_free.begin())
+        {
+            --it;
+            if(hipEventQuery(it->event) == hipSuccess)
+            {
+                hipEventDestroy(it->event);
+                hipHostFree(it->ptr);
+                m_cached_bytes -= it->size;
+                it = m_free.erase(it);
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    size_t m_max_cached_bytes;
+    size_t m_cached_bytes;
+    std::map<void *, block> m_used;
+    // The most recently released buffers are first
+    std::list<block> m_free;
+};
+
+template<class T>
+inline hipError_t pool_malloc(T ** ptr, const size_t size, hipStream_t stream = 0)
+{
+    void * p;
+    const hipError_t error = memory_pool<device_memory>::instance().allocate(&p, size, stream);
+    *ptr = static_cast<T *>(p);
+    return error;
+}
+
+inline hipError_t pool_free(void * ptr, hipStream_t stream = 0)
+{
+    return memory_pool<device_memory>::instance().deallocate(ptr, stream);
+}
+
+// Moves ownership of memory used by work on stream from to stream to.
+// Blocks of the owner are later freed on stream to, so work on to is
+// ordered after the work already enqueued on from. The host does not wait.
+inline hipError_t pool_change_stream(hipStream_t from, hipStream_t to)
+{
+    if(from == to)
+        return hipSuccess;
+
+    hipEvent_t event;
+    hipError_t error = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+    if(error != hipSuccess)
+        return error;
+    error = hipEventRecord(event, from);
+    if(error == hipSuccess)
+    {
+        error = hipStreamWaitEvent(to, event, 0);
+    }
+    // Resources of the event are released when it completes
+    const hipError_t destroy_error = hipEventDestroy(event);
+    return error != hipSuccess ? error : destroy_error;
+}
+
+template<class T>
+inline T * host_pool_malloc(const size_t count)
+{
+    void * p;
+    if(memory_pool<host_memory>::instance().allocate(&p, sizeof(T) * count, 0) != hipSuccess)
+    {
+        throw ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    return static_cast<T *>(p);
+}
+
+inline void host_pool_free(void * ptr)
+{
+    memory_pool<host_memory>::instance().deallocate(ptr, 0);
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_MEMORY_POOL_H_
@@ -22,6 +22,7 @@
 #define ROCRAND_RNG_MRG32K3A_H_
 
 #include <algorithm>
+#include <limits>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
@@ -30,6 +31,10 @@
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "output.hpp"
+#include "engine_cache.hpp"
+#include "engine_storage.hpp"
+#include "launch_tuner.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -37,18 +42,48 @@ namespace detail {
     typedef ::rocrand_device::mrg32k3a_engine mrg32k3a_device_engine;
 
     __global__
-    void init_engines_kernel(mrg32k3a_device_engine * engines,
-                            unsigned long long seed,
-                            unsigned long long offset)
+    void init_engines_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                             const unsigned int start_engine_id,
+                             unsigned long long seed,
+                             unsigned long long offset)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = mrg32k3a_device_engine(seed, engine_id, offset);
+        const unsigned int engine_id = start_engine_id + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int base_id = start_engine_id + hipBlockIdx_x * hipBlockDim_x;
+
+        // The first engine of the block is fully initialized, the others
+        // are only engine_id - base_id subsequences (A1P67/A2P67 jumps)
+        // away from it
+        if(hipThreadIdx_x == 0)
+        {
+            engines.store(base_id, mrg32k3a_device_engine(seed, base_id, offset));
+        }
+        __syncthreads();
+        mrg32k3a_device_engine engine = engines.load(base_id);
+        __syncthreads();
+
+        engine.discard_subsequence(engine_id - base_id);
+        engines.store(engine_id, engine);
     }
 
-    template<class Type, class Distribution>
+    // Engines of ROCRAND_ORDERING_PSEUDO_SEEDED and ROCRAND_ORDERING_PSEUDO_BEST
+    // are seeded independently, without subsequence jumps
     __global__
-    void generate_kernel(mrg32k3a_device_engine * engines,
-                         Type * data, const size_t n,
+    void init_seeded_engines_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                    const unsigned int start_engine_id,
+                                    unsigned long long seed,
+                                    unsigned long long offset)
+    {
+        const unsigned int engine_id = start_engine_id + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        engines.store(
+            engine_id,
+            mrg32k3a_device_engine(seeded_engine_seed(seed, engine_id), 0, offset)
+        );
+    }
+
+    template<class Output, class Distribution>
+    __global__
+    void generate_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                         Output data, const size_t n,
                          const Distribution distribution)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
@@ -56,7 +91,7 @@ namespace detail {
         unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
         // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
+        mrg32k3a_device_engine engine = engines.load(engine_id);
 
         while(index < n)
         {
@@ -66,28 +101,27 @@ namespace detail {
         }
 
         // Save engine with its state
-        engines[engine_id] = engine;
+        engines.store(engine_id, engine);
     }
 
-    template<class RealType, class Distribution>
+    template<class Output, class Distribution>
     __global__
-    void generate_normal_kernel(mrg32k3a_device_engine * engines,
-                                RealType * data, const size_t n,
+    void generate_normal_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                Output data, const size_t n,
                                 Distribution distribution)
     {
-        typedef decltype(distribution(engines->next(), engines->next())) RealType2;
+        typedef decltype(distribution(engines.load(0).next(), engines.load(0).next())) RealType2;
 
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int index = engine_id;
         unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
         // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
+        mrg32k3a_device_engine engine = engines.load(engine_id);
 
-        RealType2 * data2 = (RealType2 *)data;
         while(index < (n / 2))
         {
-            data2[index] = distribution(engine(), engine());
+            store_vector(data, index, distribution(engine(), engine()));
             // Next position
             index += stride;
         }
@@ -101,7 +135,110 @@ namespace detail {
         }
 
         // Save engine with its state
-        engines[engine_id] = engine;
+        engines.store(engine_id, engine);
+    }
+
+    template<class Distribution>
+    __global__
+    void generate_poisson_array_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                       unsigned int * data,
+                                       const double * lambdas,
+                                       const size_t n,
+                                       const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        mrg32k3a_device_engine engine = engines.load(engine_id);
+
+        while(index < n)
+        {
+            data[index] = distribution(engine, lambdas[index]);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines.store(engine_id, engine);
+    }
+
+    // Distribution generates a value using any number of values of the engine
+    template<class Type, class Distribution>
+    __global__
+    void generate_engine_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                Type * data, const size_t n,
+                                const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        mrg32k3a_device_engine engine = engines.load(engine_id);
+
+        while(index < n)
+        {
+            data[index] = distribution(engine);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines.store(engine_id, engine);
+    }
+
+    template<class Distribution>
+    __global__
+    void generate_multivariate_normal_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                             float * data, const size_t n,
+                                             const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ float factor[Distribution::shared_factor_size];
+        distribution.load(factor);
+
+        // Load device engine
+        mrg32k3a_device_engine engine = engines.load(engine_id);
+
+        while(index < n)
+        {
+            distribution(engine, data + index, n, factor);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines.store(engine_id, engine);
+    }
+
+    // Distribution generates a vector of distribution.dimensions values
+    template<class Distribution>
+    __global__
+    void generate_vector_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                float * data, const size_t n,
+                                const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        mrg32k3a_device_engine engine = engines.load(engine_id);
+
+        while(index < n)
+        {
+            distribution(engine, data + static_cast<size_t>(index) * distribution.dimensions);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines.store(engine_id, engine);
     }
 
 } // end namespace detail
@@ -117,28 +254,24 @@ public:
                      unsigned long long offset = 0,
                      hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
+          m_engines_initialized(0), m_max_blocks(s_blocks)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
         if(m_seed == 0)
         {
             m_seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
         }
+        m_engines.data = NULL;
+        m_engines.stride = 0;
     }
 
     ~rocrand_mrg32k3a()
     {
-        hipFree(m_engines);
+        rocrand_host::detail::pool_free(m_engines.data, m_stream);
     }
 
     void reset()
     {
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
     }
 
     /// Changes seed to \p seed and resets generator state.
@@ -152,122 +285,311 @@ public:
             seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
         }
         m_seed = seed;
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
     }
 
-    rocrand_status init()
+    /// Sets ordering of the generated values and resets generator state.
+    /// ROCRAND_ORDERING_PSEUDO_SEEDED seeds engines independently instead of
+    /// jumping subsequences, ROCRAND_ORDERING_PSEUDO_BEST also sizes
+    /// the engine array for the current device.
+    rocrand_status set_order(rocrand_ordering order)
     {
-        if (m_engines_initialized)
+        if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT
+           && order != ROCRAND_ORDERING_PSEUDO_BEST
+           && order != ROCRAND_ORDERING_PSEUDO_SEEDED)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        m_max_blocks = order == ROCRAND_ORDERING_PSEUDO_BEST
+            ? rocrand_host::detail::device_blocks(s_threads, s_blocks)
+            : s_blocks;
+        m_engines_initialized = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Sets the maximum number of cached engine arrays, 0 disables the cache.
+    void set_engine_cache_size(unsigned int entries)
+    {
+        m_engine_cache.set_capacity(entries);
+    }
+
+    /// Initializes engines used for \p size work items (values, vectors etc.)
+    rocrand_status init(size_t size = std::numeric_limits<size_t>::max())
+    {
+        const size_t engines_size = blocks(size) * s_threads;
+        if (engines_size <= m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+        rocrand_status status = rocrand_host::detail::grow_engines(
+            m_engines, engines_size, s_threads * m_max_blocks,
+            m_engines_initialized, m_stream
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
-        m_engines_initialized = true;
+        // Only jumped engines are cached, seeded ones are cheap to initialize
+        const bool legacy = m_order == ROCRAND_ORDERING_PSEUDO_DEFAULT;
+        const bool reset = m_engines_initialized == 0 && legacy;
+        if(reset)
+        {
+            m_engines_initialized = m_engine_cache.load(
+                m_engines, m_seed, m_offset, m_stream
+            );
+        }
+        if(m_engines_initialized < engines_size)
+        {
+            // Engines which have not been used yet are initialized
+            if(legacy)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+                    dim3((engines_size - m_engines_initialized) / s_threads), dim3(s_threads), 0, m_stream,
+                    m_engines, m_engines_initialized, m_seed, m_offset
+                );
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::init_seeded_engines_kernel),
+                    dim3((engines_size - m_engines_initialized) / s_threads), dim3(s_threads), 0, m_stream,
+                    m_engines, m_engines_initialized, m_seed, m_offset
+                );
+            }
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            if(reset)
+            {
+                m_engine_cache.store(m_engines, engines_size, m_seed, m_offset, m_stream);
+            }
+            m_engines_initialized = engines_size;
+        }
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = mrg_uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
+    template<class Output,
+             class Distribution = mrg_uniform_distribution<typename rocrand_host::detail::output_value<Output>::type> >
+    rocrand_status generate(Output data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    template<class Output>
+    rocrand_status generate_uniform(Output data, size_t data_size)
     {
+        typedef typename rocrand_host::detail::output_value<Output>::type T;
         mrg_uniform_distribution<T> udistribution;
         return generate(data, data_size, udistribution);
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_normal(Output data, size_t data_size, T mean, T stddev)
     {
         // data_size must be even
         // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(data_size%2 != 0 || !rocrand_host::detail::is_aligned(data, 2*sizeof(T)))
         {
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
         mrg_normal_distribution<T> distribution(mean, stddev);
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_log_normal(Output data, size_t data_size, T mean, T stddev)
     {
         // data_size must be even
         // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(data_size%2 != 0 || !rocrand_host::detail::is_aligned(data, 2*sizeof(T)))
         {
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
         mrg_log_normal_distribution<T> distribution(mean, stddev);
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_log_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
 
-        return ROCRAND_STATUS_SUCCESS;
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size, T mean, T stddev,
+                                             T lower, T upper)
+    {
+        rocrand_status status = init(data_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        truncated_normal_distribution<T, mrg_uniform_distribution<T> > distribution(mean, stddev, lower, upper);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_truncated_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
+        );
+    }
+
+    template<class Format>
+    rocrand_status generate_uniform_16(unsigned short * data, size_t data_size)
+    {
+        // Two values are generated from each 32-bit number:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        mrg_uniform_distribution<Format> distribution;
+        return generate(reinterpret_cast<unsigned int *>(data), data_size / 2, distribution);
+    }
+
+    template<class Format>
+    rocrand_status generate_normal_16(unsigned short * data, size_t data_size, float mean, float stddev)
+    {
+        // Two values are generated from each pair of 32-bit numbers:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        unsigned int * words_data = reinterpret_cast<unsigned int *>(data);
+        const size_t words = data_size / 2;
+        rocrand_status status = init(words);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        mrg_normal_distribution<Format> distribution(mean, stddev);
+
+        return rocrand_host::detail::tuned_launch<decltype(words_data), decltype(distribution)>(
+            rng_type, "generate_normal", words, blocks(words) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, words_data, words, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const float * mean, const float * factor)
+    {
+        rocrand_status status = init(n_vectors);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return rocrand_host::detail::dispatch_multivariate_normal<mrg_normal_distribution<float> >(
+            *this, data, n_vectors, dimensions, mean, factor
+        );
+    }
+
+    // Used by dispatch_multivariate_normal
+    template<class Distribution>
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                const Distribution& distribution)
+    {
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_multivariate_normal", n_vectors, blocks(n_vectors) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, n_vectors, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_sphere(float * data, size_t n_points,
+                                   unsigned int dimensions, sphere_shape shape)
+    {
+        rocrand_status status = init(n_points);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        sphere_distribution<mrg_uniform_distribution<float>, mrg_normal_distribution<float> > distribution(shape, dimensions);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_sphere", n_points, blocks(n_points) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_vector_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, n_points, distribution
+                );
+            }
+        );
     }
 
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
@@ -276,10 +598,83 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_poisson_array(unsigned int * data, const double * lambdas, size_t data_size)
+    {
+        rocrand_status status = init(data_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        poisson_array_distribution distribution;
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_poisson_array", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, lambdas, data_size, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t n_bits, double p)
+    {
+        const size_t words = (n_bits + 31) / 32;
+        if(p == 0.5)
+        {
+            // Random bits are copied as they are
+            return generate_uniform(data, words);
+        }
+
+        rocrand_status status = init(words);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        bernoulli_bits_distribution<mrg_uniform_distribution<unsigned int> > distribution(p);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_bernoulli_bits", words, blocks(words) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, words, distribution
+                );
+            }
+        );
+    }
+
+    // Generates the first k elements of a random permutation of [0, n)
+    rocrand_status generate_permutation(unsigned int * data, size_t k, unsigned long long n)
+    {
+        return m_permutation.generate(*this, data, k, n, m_stream);
+    }
+
+    // Generates Latin hypercube samples, dimension-major
+    rocrand_status generate_latin_hypercube(float * data, size_t n_points, unsigned int dimensions)
+    {
+        return m_permutation.generate_latin_hypercube(*this, data, n_points, dimensions, m_stream);
+    }
+
+    poisson_distribution_manager<>& get_poisson_manager()
+    {
+        return m_poisson;
+    }
+
 private:
-    bool m_engines_initialized;
-    engine_type * m_engines;
-    size_t m_engines_size;
+    // Number of initialized engines, engines are allocated and initialized
+    // lazily for the largest request since the last reset
+    size_t m_engines_initialized;
+    // Engines are stored as a structure of arrays for coalesced accesses
+    rocrand_host::detail::soa_engines<engine_type> m_engines;
+    // Initialized engines of recently used seeds and offsets
+    rocrand_host::detail::engine_cache<engine_type> m_engine_cache;
+    // Maximum number of blocks (s_blocks unless the ordering is
+    // ROCRAND_ORDERING_PSEUDO_BEST)
+    unsigned int m_max_blocks;
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 128;
     static const uint32_t s_blocks = 128;
@@ -288,9 +683,18 @@ private:
     static const uint32_t s_blocks = 512;
     #endif
 
+    // Number of blocks for size work items
+    unsigned int blocks(size_t size) const
+    {
+        return rocrand_host::detail::generator_blocks(size, s_threads, m_max_blocks);
+    }
+
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // Round keys of permutations and Latin hypercubes
+    permutation_manager m_permutation;
+
     // m_seed from base_type
     // m_offset from base_type
 };
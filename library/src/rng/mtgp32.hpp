@@ -64,6 +64,8 @@
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "output.hpp"
+#include "memory_pool.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -72,10 +74,10 @@ namespace detail {
     typedef ::rocrand_device::mtgp32_state mtgp32_state;
     typedef ::rocrand_device::mtgp32_param mtgp32_param;
 
-    template<class Type, class Distribution>
+    template<class Output, class Distribution>
     __global__
     void generate_kernel(mtgp32_device_engine * engines,
-                         Type * data,
+                         Output data,
                          const size_t size,
                          const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
                          const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
@@ -108,6 +110,216 @@ namespace detail {
         engines[engine_id].copy(&engine);
     }
 
+    template<class Distribution>
+    __global__
+    void generate_poisson_array_kernel(mtgp32_device_engine * engines,
+                                       unsigned int * data,
+                                       const double * lambdas,
+                                       const size_t size,
+                                       const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
+                                       const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
+                                       Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        // All threads of the block must draw values together, so inversion
+        // (exactly one value per sample) is used
+        while(index < size_down)
+        {
+            data[index] = distribution(engine(), lambdas[index]);
+            // Next position
+            index += stride;
+        }
+        while(index < size_up)
+        {
+            const unsigned int value = engine();
+            if(index < size)
+                data[index] = distribution(value, lambdas[index]);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines[engine_id].copy(&engine);
+    }
+
+    // Distribution generates a value using a fixed number of values of the engine,
+    // so all threads of the block stay in lockstep
+    template<class Type, class Distribution>
+    __global__
+    void generate_engine_kernel(mtgp32_device_engine * engines,
+                                Type * data,
+                                const size_t size,
+                                const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
+                                const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
+                                Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        while(index < size_down)
+        {
+            data[index] = distribution(engine);
+            // Next position
+            index += stride;
+        }
+        while(index < size_up)
+        {
+            const Type value = distribution(engine);
+            if(index < size)
+                data[index] = value;
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines[engine_id].copy(&engine);
+    }
+
+    template<class Distribution>
+    __global__
+    void generate_multivariate_normal_kernel(mtgp32_device_engine * engines,
+                                             float * data,
+                                             const size_t size,
+                                             const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
+                                             const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
+                                             const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ float factor[Distribution::shared_factor_size];
+        distribution.load(factor);
+
+        // Load device engine
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        while(index < size_down)
+        {
+            distribution(engine, data + index, size, factor);
+            // Next position
+            index += stride;
+        }
+        while(index < size_up)
+        {
+            // All threads of the block must draw the same number of values
+            if(index < size)
+                distribution(engine, data + index, size, factor);
+            else
+                distribution.discard(engine);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines[engine_id].copy(&engine);
+    }
+
+    // Distribution generates a value after an unknown number of attempts, every
+    // attempt uses a fixed number of values of the engine. All threads of the block
+    // make attempts until each of them has its value, so they stay in lockstep.
+    template<class Type, class Distribution>
+    __global__
+    void generate_attempts_kernel(mtgp32_device_engine * engines,
+                                  Type * data,
+                                  const size_t size,
+                                  const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
+                                  Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        __shared__ bool pending;
+        while(index < size_up)
+        {
+            Type value;
+            bool done = index >= size;
+            do
+            {
+                Type attempt_value;
+                const bool accepted = distribution.attempt(engine, attempt_value);
+                if(accepted && !done)
+                {
+                    value = attempt_value;
+                    done = true;
+                }
+                __syncthreads();
+                if(hipThreadIdx_x == 0)
+                    pending = false;
+                __syncthreads();
+                if(!done)
+                    pending = true;
+                __syncthreads();
+            } while(pending);
+
+            if(index < size)
+                data[index] = value;
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines[engine_id].copy(&engine);
+    }
+
+    // Distribution generates a vector of distribution.dimensions values
+    // using a fixed number of values of the engine
+    template<class Distribution>
+    __global__
+    void generate_vector_kernel(mtgp32_device_engine * engines,
+                                float * data,
+                                const size_t size,
+                                const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
+                                const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
+                                const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        while(index < size_down)
+        {
+            distribution(engine, data + static_cast<size_t>(index) * distribution.dimensions);
+            // Next position
+            index += stride;
+        }
+        while(index < size_up)
+        {
+            // All threads of the block must draw the same number of values
+            if(index < size)
+                distribution(engine, data + static_cast<size_t>(index) * distribution.dimensions);
+            else
+                distribution.discard(engine);
+            // Next position
+            index += stride;
+        }
+
+        // Save engine with its state
+        engines[engine_id].copy(&engine);
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -124,7 +336,7 @@ public:
           m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
     {
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        auto error = rocrand_host::detail::pool_malloc(&m_engines, sizeof(engine_type) * m_engines_size, m_stream);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -133,7 +345,7 @@ public:
 
     ~rocrand_mtgp32()
     {
-        hipFree(m_engines);
+        rocrand_host::detail::pool_free(m_engines, m_stream);
     }
 
     void reset()
@@ -157,6 +369,20 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Sets ordering of the generated values. Each block generates values
+    /// of its own state, the geometry is part of the sequence, so
+    /// ROCRAND_ORDERING_PSEUDO_BEST is the same as the default ordering.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT
+           && order != ROCRAND_ORDERING_PSEUDO_BEST)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
@@ -173,8 +399,9 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
+    template<class Output,
+             class Distribution = uniform_distribution<typename rocrand_host::detail::output_value<Output>::type> >
+    rocrand_status generate(Output data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
         rocrand_status status = init();
@@ -201,32 +428,173 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    template<class Output>
+    rocrand_status generate_uniform(Output data, size_t data_size)
     {
+        typedef typename rocrand_host::detail::output_value<Output>::type T;
         uniform_distribution<T> distribution;
         return generate(data, data_size, distribution);
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_normal(Output data, size_t data_size, T mean, T stddev)
     {
         normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_log_normal(Output data, size_t data_size, T mean, T stddev)
     {
         log_normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size, T mean, T stddev,
+                                             T lower, T upper)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+
+        const size_t remainder_value = data_size%s_threads;
+        const size_t size_rounded_down = data_size - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? data_size : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_attempts_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, size_rounded_up, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class Format>
+    rocrand_status generate_uniform_16(unsigned short * data, size_t data_size)
+    {
+        // Two values are generated from each 32-bit number:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        uniform_distribution<Format> distribution;
+        return generate(reinterpret_cast<unsigned int *>(data), data_size / 2, distribution);
+    }
+
+    template<class Format>
+    rocrand_status generate_normal_16(unsigned short * data, size_t data_size, float mean, float stddev)
+    {
+        // Two values are generated from each pair of 32-bit numbers:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        normal_distribution<Format> distribution(mean, stddev);
+
+        unsigned int * words_data = reinterpret_cast<unsigned int *>(data);
+        const size_t words = data_size / 2;
+        const size_t remainder_value = words%s_threads;
+        const size_t size_rounded_down = words - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? words : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, words_data, words, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const float * mean, const float * factor)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return rocrand_host::detail::dispatch_multivariate_normal<normal_distribution<float> >(
+            *this, data, n_vectors, dimensions, mean, factor
+        );
+    }
+
+    // Used by dispatch_multivariate_normal
+    template<class Distribution>
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                const Distribution& distribution)
+    {
+        const size_t remainder_value = n_vectors%s_threads;
+        const size_t size_rounded_down = n_vectors - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? n_vectors : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, n_vectors, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_sphere(float * data, size_t n_points,
+                                   unsigned int dimensions, sphere_shape shape)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        sphere_distribution<> distribution(shape, dimensions);
+
+        const size_t remainder_value = n_points%s_threads;
+        const size_t size_rounded_down = n_points - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? n_points : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_vector_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, n_points, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
@@ -235,6 +603,82 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_poisson_array(unsigned int * data, const double * lambdas, size_t data_size)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        poisson_array_distribution distribution;
+
+        const size_t remainder_value = data_size%s_threads;
+        const size_t size_rounded_down = data_size - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? data_size : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, lambdas, data_size, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t n_bits, double p)
+    {
+        const size_t words = (n_bits + 31) / 32;
+        if(p == 0.5)
+        {
+            // Random bits are copied as they are
+            return generate_uniform(data, words);
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        bernoulli_bits_distribution<> distribution(p);
+
+        const size_t remainder_value = words%s_threads;
+        const size_t size_rounded_down = words - remainder_value;
+        const size_t size_rounded_up =
+            remainder_value == 0 ? words : size_rounded_down + s_threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, words, size_rounded_up,
+            size_rounded_down, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Generates the first k elements of a random permutation of [0, n)
+    rocrand_status generate_permutation(unsigned int * data, size_t k, unsigned long long n)
+    {
+        return m_permutation.generate(*this, data, k, n, m_stream);
+    }
+
+    // Generates Latin hypercube samples, dimension-major
+    rocrand_status generate_latin_hypercube(float * data, size_t n_points, unsigned int dimensions)
+    {
+        return m_permutation.generate_latin_hypercube(*this, data, n_points, dimensions, m_stream);
+    }
+
+    poisson_distribution_manager<>& get_poisson_manager()
+    {
+        return m_poisson;
+    }
+
 private:
     bool m_engines_initialized;
     engine_type * m_engines;
@@ -250,6 +694,9 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // Round keys of permutations and Latin hypercubes
+    permutation_manager m_permutation;
+
     // m_seed from base_type
     // m_offset from base_type
 };
@@ -0,0 +1,118 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_OUTPUT_H_
+#define ROCRAND_RNG_OUTPUT_H_
+
+#include <stdint.h>
+
+#include "common.hpp"
+
+// Output of values with a constant distance between them (columns of
+// structures of arrays, fields of arrays of structures) and/or rows of
+// a pitched 2D allocation.
+//
+// Value i of the dense output is stored at column i % width of row i / width:
+//     data[(i / width) * pitch + (i % width) * stride]
+// pitch is 0 when there is only one row, then no division is needed.
+// Distances are in elements of T.
+template<class T>
+struct strided_output
+{
+    typedef T value_type;
+
+    T * data;
+    size_t width;
+    size_t stride;
+    size_t pitch;
+
+    __host__ __device__
+    strided_output(T * data, size_t width, size_t stride, size_t pitch)
+        : data(data), width(width), stride(stride), pitch(pitch) {}
+
+    FQUALIFIERS
+    T& operator[](const size_t i) const
+    {
+        if(pitch == 0)
+        {
+            return data[i * stride];
+        }
+        const size_t row = i / width;
+        const size_t column = i - row * width;
+        return data[row * pitch + column * stride];
+    }
+};
+
+namespace rocrand_host {
+namespace detail {
+
+    // Type of values of an output
+    template<class Output>
+    struct output_value
+    {
+        typedef typename Output::value_type type;
+    };
+
+    template<class T>
+    struct output_value<T *>
+    {
+        typedef T type;
+    };
+
+    template<class T>
+    FQUALIFIERS
+    bool is_aligned(T * data, const size_t alignment)
+    {
+        return ((uintptr_t)data) % alignment == 0;
+    }
+
+    // Strided outputs are stored value by value
+    template<class T>
+    FQUALIFIERS
+    bool is_aligned(const strided_output<T>&, const size_t)
+    {
+        return true;
+    }
+
+    // Stores vector V (for example, float2 or uint4) as values
+    // index * N, ..., index * N + N - 1, where N = sizeof(V) / sizeof(T)
+    template<class T, class V>
+    FQUALIFIERS
+    void store_vector(T * data, const size_t index, const V& value)
+    {
+        ((V *)data)[index] = value;
+    }
+
+    template<class T, class V>
+    FQUALIFIERS
+    void store_vector(const strided_output<T>& data, const size_t index, const V& value)
+    {
+        const unsigned int n = sizeof(V) / sizeof(T);
+        const T * values = (const T *)&value;
+        for(unsigned int i = 0; i < n; i++)
+        {
+            data[index * n + i] = values[i];
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_OUTPUT_H_
@@ -54,6 +54,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ROCRAND_RNG_PHILOX4X32_10_H_
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
@@ -61,6 +63,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "output.hpp"
+#include "engine_storage.hpp"
+#include "batch.hpp"
+#include "launch_tuner.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -137,6 +143,18 @@ namespace detail {
       return val;
     }
 
+    inline __device__ unsigned int warp_reduce_max(unsigned int val, int size) {
+      for (int offset = size/2; offset > 0; offset /= 2) {
+        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
+        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
+        #else
+        unsigned int temp = __shfl_xor((int)val, offset);
+        #endif
+        val = (temp > val) ? temp : val;
+      }
+      return val;
+    }
+
     struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engine
     {
         typedef ::rocrand_device::philox4x32_10_engine base_type;
@@ -169,54 +187,95 @@ namespace detail {
         // m_state from base class
     };
 
+    // Returns single 32-bit values from uint4 produced by next4_leap(), so
+    // samplers which consume a variable number of values can use the engine
+    // shared by ThreadsPerEngine threads without overlapping with other threads.
+    template<unsigned int ThreadsPerEngine>
+    struct philox4x32_10_leap_engine
+    {
+        philox4x32_10_device_engine& engine;
+        uint4 values;
+        unsigned int position;
+        // Number of next4_leap() calls
+        unsigned int leaps;
+
+        __forceinline__ __device__ __host__
+        philox4x32_10_leap_engine(philox4x32_10_device_engine& engine)
+            : engine(engine), position(4), leaps(0) { }
+
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
+        {
+            if(position == 4)
+            {
+                values = engine.next4_leap(ThreadsPerEngine);
+                position = 0;
+                leaps++;
+            }
+            return (&values.x)[position++];
+        }
+    };
+
     __global__
     void init_engines_kernel(philox4x32_10_device_engine * engines,
+                             const unsigned int start_engine_id,
+                             const unsigned int end_engine_id,
                              const unsigned long long seed,
                              const unsigned long long offset)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        const unsigned int engine_id = start_engine_id + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(engine_id < end_engine_id)
+        {
+            engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        }
     }
 
-    template<unsigned int ThreadsPerEngine, class Distribution>
-    __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
-                         double * data, const size_t n,
-                         Distribution distribution)
+    // Each uint4 gives 4 values (2 for double)
+    //
+    // Work of thread index of a grid with stride threads, all ThreadsPerEngine
+    // threads of an engine must call it together (warp_reduce_min)
+    template<unsigned int ThreadsPerEngine, class Output, class Distribution>
+    __forceinline__ __device__
+    void generate_values(philox4x32_10_device_engine * engines,
+                         Output data, const size_t n,
+                         Distribution& distribution,
+                         unsigned int index,
+                         const unsigned int stride)
     {
         typedef philox4x32_10_device_engine DeviceEngineType;
-        typedef decltype(distribution(uint4())) Type2;
-        typedef typename unaligned_type<Type2>::type Type2_unaligned;
+        typedef typename output_value<Output>::type Type;
+        // TypeX can be uint4, float4, double2, ...
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        // x can be 2 or 4
+        const unsigned int x = sizeof(TypeX) / sizeof(Type);
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
         // Load device engine
         DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        if(index%ThreadsPerEngine > 0)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+            // Skips index%ThreadsPerEngine states
+            engine.discard(4 * (index%ThreadsPerEngine));
         }
 
-        if(((uintptr_t)data)%(sizeof(Type2)) == 0)
+        if(is_aligned(data, sizeof(TypeX)))
         {
-            Type2 * data2 = (Type2 *)data;
-            while(index < (n/2))
+            while(index < (n/x))
             {
-                data2[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                store_vector(data, index, distribution(engine.next4_leap(ThreadsPerEngine)));
                 // Next position
                 index += stride;
             }
         }
         else
         {
-            Type2_unaligned * data2 = (Type2_unaligned *)data;
-            while(index < (n/2))
+            while(index < (n/x))
             {
-                Type2 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data2[index] = *(Type2_unaligned*)(&result);  // reinterpret as Type4_unaligned
+                TypeX result = distribution(engine.next4_leap(ThreadsPerEngine));
+                // reinterpret as TypeX_unaligned
+                store_vector(data, index, *(TypeX_unaligned*)(&result));
                 // Next position
                 index += stride;
             }
@@ -226,18 +285,20 @@ namespace detail {
         unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
         const bool smallest_state = (index == index_min);
 
-        // Check if we need to save tail (last 1 random number).
+        // Check if we need to save tail (last 1,..,(x-1) random numbers).
         // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+1 (index < (n/2) would be
+        // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
         // true in such situation).
         // If this condition is met, then we know that (index == index_min)
         // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 1;
-        if((index == n/2) && tail_size > 0)
+        auto tail_size = n & (x - 1);
+        if((index == n/x) && tail_size > 0)
         {
-            Type2 result = distribution(engine.next4());
+            TypeX result = distribution(engine.next4());
             // Save the tail
-            data[n - tail_size] = result.x;
+            data[n - tail_size] = (&result.x)[0]; // .x
+            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
         }
 
         // Save engine
@@ -245,82 +306,49 @@ namespace detail {
             engines[engine_id] = engine;
     }
 
-    template<unsigned int ThreadsPerEngine, class Type, class Distribution>
+    template<unsigned int ThreadsPerEngine, class Output, class Distribution>
     __global__
     void generate_kernel(philox4x32_10_device_engine * engines,
-                         Type * data, const size_t n,
+                         Output data, const size_t n,
                          Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
-        typedef decltype(distribution(uint4())) Type4;
-        typedef typename unaligned_type<Type4>::type Type4_unaligned;
-
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
-        {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
-        }
-
-        if(((uintptr_t)data)%(sizeof(Type4)) == 0)
-        {
-            Type4 * data4 = (Type4 *)data;
-            while(index < (n/4))
-            {
-                data4[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-                // Next position
-                index += stride;
-            }
-        }
-        else
-        {
-            Type4_unaligned * data4 = (Type4_unaligned *)data;
-            while(index < (n/4))
-            {
-                Type4 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data4[index] = *(Type4_unaligned*)(&result);  // reinterpret as Type4_unaligned
-                // Next position
-                index += stride;
-            }
-        }
-
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
+        generate_values<ThreadsPerEngine>(
+            engines, data, n, distribution,
+            hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x,
+            hipGridDim_x * hipBlockDim_x
+        );
+    }
 
-        // Check if we need to save tail (last 1,2,3 random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+3 (index < (n/4) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 3;
-        if((index == n/4) && tail_size > 0)
-        {
-            Type4 result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = result.x;
-            if(tail_size > 1) data[n - tail_size + 1] = result.y;
-            if(tail_size > 2) data[n - tail_size + 2] = result.z;
-        }
+    typedef batch_item<philox4x32_10_device_engine *> philox4x32_10_batch_item;
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+    // Requests of several generators in one launch, items begin at multiples
+    // of ThreadsPerEngine, so threads of an engine are in the same item
+    template<unsigned int ThreadsPerEngine>
+    __global__
+    void generate_batched_kernel(const philox4x32_10_batch_item * items,
+                                 const unsigned int count)
+    {
+        const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int i = find_batch_item(items, count, id);
+        if(i == count)
+            return;
+
+        const philox4x32_10_batch_item item = items[i];
+        uniform_distribution<unsigned int> distribution;
+        generate_values<ThreadsPerEngine>(
+            item.engines, item.data, item.n, distribution,
+            id - item.begin, item.stride
+        );
     }
 
-    template<unsigned int ThreadsPerEngine, class RealType, class Distribution>
+    template<unsigned int ThreadsPerEngine, class Output, class Distribution>
     __global__
     void generate_normal_kernel(philox4x32_10_device_engine * engines,
-                                RealType * data, const size_t n,
+                                Output data, const size_t n,
                                 Distribution distribution)
     {
         typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef typename output_value<Output>::type RealType;
         // RealTypeX can be float4, double2
         typedef decltype(distribution(uint4())) RealTypeX;
         // x can be 2 or 4
@@ -338,10 +366,9 @@ namespace detail {
             engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
         }
 
-        RealTypeX * dataX = (RealTypeX *)data;
         while(index < (n/x))
         {
-            dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+            store_vector(data, index, distribution(engine.next4_leap(ThreadsPerEngine)));
             // Next position
             index += stride;
         }
@@ -449,6 +476,172 @@ namespace detail {
             engines[engine_id] = engine;
     }
 
+    template <unsigned int ThreadsPerEngine, class Distribution>
+    __global__
+    void generate_poisson_array_kernel(philox4x32_10_device_engine * engines,
+                                       unsigned int * data,
+                                       const double * lambdas,
+                                       const size_t n,
+                                       const Distribution distribution)
+    {
+        typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef philox4x32_10_leap_engine<ThreadsPerEngine> LeapEngineType;
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        const DeviceEngineType base_engine = engines[engine_id];
+        DeviceEngineType engine = base_engine;
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        // Each thread uses every ThreadsPerEngine-th state of the engine,
+        // starting from its own state, so threads don't use the same values
+        // even if they consume different number of them
+        LeapEngineType leap_engine(engine);
+        while(index < n)
+        {
+            data[index] = distribution(leap_engine, lambdas[index]);
+            index += stride;
+        }
+
+        // The engine is saved after the last state used by any of the threads
+        const unsigned int max_leaps = warp_reduce_max(leap_engine.leaps, ThreadsPerEngine);
+        if(hipThreadIdx_x%ThreadsPerEngine == 0)
+        {
+            DeviceEngineType next_engine = base_engine;
+            next_engine.discard(4ULL * ThreadsPerEngine * max_leaps);
+            engines[engine_id] = next_engine;
+        }
+    }
+
+    // Distribution generates a value using any number of values of the engine
+    template<unsigned int ThreadsPerEngine, class Type, class Distribution>
+    __global__
+    void generate_engine_kernel(philox4x32_10_device_engine * engines,
+                                Type * data, const size_t n,
+                                const Distribution distribution)
+    {
+        typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef philox4x32_10_leap_engine<ThreadsPerEngine> LeapEngineType;
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        const DeviceEngineType base_engine = engines[engine_id];
+        DeviceEngineType engine = base_engine;
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        LeapEngineType leap_engine(engine);
+        while(index < n)
+        {
+            data[index] = distribution(leap_engine);
+            index += stride;
+        }
+
+        // The engine is saved after the last state used by any of the threads
+        const unsigned int max_leaps = warp_reduce_max(leap_engine.leaps, ThreadsPerEngine);
+        if(hipThreadIdx_x%ThreadsPerEngine == 0)
+        {
+            DeviceEngineType next_engine = base_engine;
+            next_engine.discard(4ULL * ThreadsPerEngine * max_leaps);
+            engines[engine_id] = next_engine;
+        }
+    }
+
+    template<unsigned int ThreadsPerEngine, class Distribution>
+    __global__
+    void generate_multivariate_normal_kernel(philox4x32_10_device_engine * engines,
+                                             float * data, const size_t n,
+                                             const Distribution distribution)
+    {
+        typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef philox4x32_10_leap_engine<ThreadsPerEngine> LeapEngineType;
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ float factor[Distribution::shared_factor_size];
+        distribution.load(factor);
+
+        // Load device engine
+        const DeviceEngineType base_engine = engines[engine_id];
+        DeviceEngineType engine = base_engine;
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        LeapEngineType leap_engine(engine);
+        while(index < n)
+        {
+            distribution(leap_engine, data + index, n, factor);
+            index += stride;
+        }
+
+        // The engine is saved after the last state used by any of the threads
+        const unsigned int max_leaps = warp_reduce_max(leap_engine.leaps, ThreadsPerEngine);
+        if(hipThreadIdx_x%ThreadsPerEngine == 0)
+        {
+            DeviceEngineType next_engine = base_engine;
+            next_engine.discard(4ULL * ThreadsPerEngine * max_leaps);
+            engines[engine_id] = next_engine;
+        }
+    }
+
+    // Distribution generates a vector of distribution.dimensions values
+    template<unsigned int ThreadsPerEngine, class Distribution>
+    __global__
+    void generate_vector_kernel(philox4x32_10_device_engine * engines,
+                                float * data, const size_t n,
+                                const Distribution distribution)
+    {
+        typedef philox4x32_10_device_engine DeviceEngineType;
+        typedef philox4x32_10_leap_engine<ThreadsPerEngine> LeapEngineType;
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        const DeviceEngineType base_engine = engines[engine_id];
+        DeviceEngineType engine = base_engine;
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        LeapEngineType leap_engine(engine);
+        while(index < n)
+        {
+            distribution(leap_engine, data + static_cast<size_t>(index) * distribution.dimensions);
+            index += stride;
+        }
+
+        // The engine is saved after the last state used by any of the threads
+        const unsigned int max_leaps = warp_reduce_max(leap_engine.leaps, ThreadsPerEngine);
+        if(hipThreadIdx_x%ThreadsPerEngine == 0)
+        {
+            DeviceEngineType next_engine = base_engine;
+            next_engine.discard(4ULL * ThreadsPerEngine * max_leaps);
+            engines[engine_id] = next_engine;
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -464,71 +657,153 @@ public:
                           unsigned long long offset = 0,
                           hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL),
-          m_engines_size(s_threads * s_blocks / s_threads_per_engine)
+          m_engines_initialized(0), m_engines(NULL), m_engines_size(0),
+          m_max_blocks(s_blocks)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
+
     }
 
     ~rocrand_philox4x32_10()
     {
-        hipFree(m_engines);
+        rocrand_host::detail::pool_free(m_engines, m_stream);
     }
 
     void reset()
     {
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
     }
 
     /// Changes seed to \p seed and resets generator state.
     void set_seed(unsigned long long seed)
     {
         m_seed = seed;
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
-        m_engines_initialized = false;
+        m_engines_initialized = 0;
+    }
+
+    /// Sets ordering of the generated values and resets generator state.
+    /// ROCRAND_ORDERING_PSEUDO_BEST sizes the engine array for the current
+    /// device. Jumps of Philox are just counter increments, so there is
+    /// no ROCRAND_ORDERING_PSEUDO_SEEDED.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT
+           && order != ROCRAND_ORDERING_PSEUDO_BEST)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        m_max_blocks = order == ROCRAND_ORDERING_PSEUDO_BEST
+            ? rocrand_host::detail::device_blocks(s_threads, s_blocks)
+            : s_blocks;
+        m_engines_initialized = 0;
+        return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status init()
+    /// Initializes engines used for \p size work items (values, vectors etc.)
+    rocrand_status init(size_t size = std::numeric_limits<size_t>::max())
     {
-        if(m_engines_initialized)
+        const size_t engines_size = blocks(size) * s_threads / s_threads_per_engine;
+        if(engines_size <= m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        rocrand_status status = rocrand_host::detail::grow_engines(
+            m_engines, m_engines_size, engines_size, s_threads * m_max_blocks / s_threads_per_engine,
+            m_engines_initialized, m_stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Engines which have not been used yet are initialized
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+            dim3((engines_size - m_engines_initialized + s_threads - 1) / s_threads), dim3(s_threads), 0, m_stream,
+            m_engines, m_engines_initialized, engines_size, m_seed, m_offset
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
-        m_engines_initialized = true;
+        m_engines_initialized = engines_size;
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
+    template<class Output,
+             class Distribution = uniform_distribution<typename rocrand_host::detail::output_value<Output>::type> >
+    rocrand_status generate(Output data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
+        );
+    }
+
+    /// Generates 32-bit values for count generators in one launch on
+    /// the stream of the first generator, all generators must use it
+    static rocrand_status generate_batched(rocrand_philox4x32_10 ** generators,
+                                           unsigned int ** data,
+                                           const size_t * sizes,
+                                           const unsigned int count)
+    {
+        typedef rocrand_host::detail::philox4x32_10_batch_item item_type;
+
+        const hipStream_t stream = generators[0]->m_stream;
+        std::vector<item_type> items;
+        unsigned int threads = 0;
+        for(unsigned int i = 0; i < count; i++)
+        {
+            rocrand_philox4x32_10 * generator = generators[i];
+            if(sizes[i] == 0)
+                continue;
+            rocrand_status status = generator->init(sizes[i]);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            // Threads after the one which saves the tail (index n / 4) do not
+            // change engines, whole engines are kept
+            const size_t used_threads =
+                (sizes[i] / 4 + s_threads_per_engine) / s_threads_per_engine * s_threads_per_engine;
+            item_type item;
+            item.engines = generator->m_engines;
+            item.data = data[i];
+            item.n = sizes[i];
+            item.stride = generator->blocks(sizes[i]) * s_threads;
+            item.begin = threads;
+            item.threads = static_cast<unsigned int>(std::min<size_t>(item.stride, used_threads));
+            items.push_back(item);
+            threads += item.threads;
+        }
+        if(items.empty())
+            return ROCRAND_STATUS_SUCCESS;
+
+        item_type * d_items;
+        rocrand_status status = rocrand_host::detail::upload_batch(items, d_items, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_batched_kernel<s_threads_per_engine>),
+            dim3((threads + s_threads - 1) / s_threads), dim3(s_threads), 0, stream,
+            d_items, static_cast<unsigned int>(items.size())
         );
+        rocrand_host::detail::pool_free(d_items, stream);
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
@@ -536,107 +811,312 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    template<class Output>
+    rocrand_status generate_uniform(Output data, size_t data_size)
     {
+        typedef typename rocrand_host::detail::output_value<Output>::type T;
         uniform_distribution<T> udistribution;
         return generate(data, data_size, udistribution);
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_normal(Output data, size_t data_size, T mean, T stddev)
     {
         // data_size must be even
         // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(data_size%2 != 0 || !rocrand_host::detail::is_aligned(data, 2*sizeof(T)))
         {
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
         normal_distribution<T> distribution(mean, stddev);
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_log_normal(Output data, size_t data_size, T mean, T stddev)
     {
         // data_size must be even
         // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        if(data_size%2 != 0 || !rocrand_host::detail::is_aligned(data, 2*sizeof(T)))
         {
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
         log_normal_distribution<T> distribution(mean, stddev);
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_log_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
 
-        return ROCRAND_STATUS_SUCCESS;
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size, T mean, T stddev,
+                                             T lower, T upper)
+    {
+        rocrand_status status = init(data_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_truncated_normal", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, distribution
+                );
+            }
+        );
+    }
+
+    template<class Format>
+    rocrand_status generate_uniform_16(unsigned short * data, size_t data_size)
+    {
+        // Two values are generated from each 32-bit number:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        uniform_distribution<Format> distribution;
+        return generate(reinterpret_cast<unsigned int *>(data), data_size / 2, distribution);
+    }
+
+    template<class Format>
+    rocrand_status generate_normal_16(unsigned short * data, size_t data_size, float mean, float stddev)
+    {
+        // Two values are generated from each pair of 32-bit numbers:
+        // data_size must be even, data must be aligned to 4 bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%sizeof(unsigned int)) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        unsigned int * words_data = reinterpret_cast<unsigned int *>(data);
+        const size_t words = data_size / 2;
+        rocrand_status status = init(words);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        normal_distribution<Format> distribution(mean, stddev);
+
+        return rocrand_host::detail::tuned_launch<decltype(words_data), decltype(distribution)>(
+            rng_type, "generate_normal", words, blocks(words) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, words_data, words, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const float * mean, const float * factor)
+    {
+        rocrand_status status = init(n_vectors);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return rocrand_host::detail::dispatch_multivariate_normal<normal_distribution<float> >(
+            *this, data, n_vectors, dimensions, mean, factor
+        );
+    }
+
+    // Used by dispatch_multivariate_normal
+    template<class Distribution>
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                const Distribution& distribution)
+    {
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_multivariate_normal", n_vectors, blocks(n_vectors) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, n_vectors, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_sphere(float * data, size_t n_points,
+                                   unsigned int dimensions, sphere_shape shape)
+    {
+        rocrand_status status = init(n_points);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        sphere_distribution<> distribution(shape, dimensions);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_sphere", n_points, blocks(n_points) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_vector_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, n_points, distribution
+                );
+            }
+        );
     }
 
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
-        rocrand_status status = init();
+        rocrand_status status = init(data_size);
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
             return status;
         }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, m_poisson.dis
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(m_poisson.dis)>(
+            rng_type, "generate_poisson", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, data_size, m_poisson.dis
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
 
-        return ROCRAND_STATUS_SUCCESS;
+    rocrand_status generate_poisson_array(unsigned int * data, const double * lambdas, size_t data_size)
+    {
+        rocrand_status status = init(data_size);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        poisson_array_distribution distribution;
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_poisson_array", data_size, blocks(data_size) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, lambdas, data_size, distribution
+                );
+            }
+        );
+    }
+
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t n_bits, double p)
+    {
+        const size_t words = (n_bits + 31) / 32;
+        if(p == 0.5)
+        {
+            // Random bits are copied as they are
+            return generate_uniform(data, words);
+        }
+
+        rocrand_status status = init(words);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        bernoulli_bits_distribution<> distribution(p);
+
+        return rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_bernoulli_bits", words, blocks(words) * s_threads, s_threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_engine_kernel<s_threads_per_engine>),
+                    dim3(grid), dim3(block), 0, m_stream,
+                    m_engines, data, words, distribution
+                );
+            }
+        );
+    }
+
+    // Generates the first k elements of a random permutation of [0, n)
+    rocrand_status generate_permutation(unsigned int * data, size_t k, unsigned long long n)
+    {
+        return m_permutation.generate(*this, data, k, n, m_stream);
+    }
+
+    // Generates Latin hypercube samples, dimension-major
+    rocrand_status generate_latin_hypercube(float * data, size_t n_points, unsigned int dimensions)
+    {
+        return m_permutation.generate_latin_hypercube(*this, data, n_points, dimensions, m_stream);
+    }
+
+    poisson_distribution_manager<>& get_poisson_manager()
+    {
+        return m_poisson;
     }
 
 private:
-    bool m_engines_initialized;
+    // Number of initialized engines, engines are allocated and initialized
+    // lazily for the largest request since the last reset
+    size_t m_engines_initialized;
     engine_type * m_engines;
-    const size_t m_engines_size;
+    size_t m_engines_size;
+    // Maximum number of blocks (s_blocks unless the ordering is
+    // ROCRAND_ORDERING_PSEUDO_BEST)
+    unsigned int m_max_blocks;
 
     const static uint32_t s_threads = 256;
     const static uint32_t s_blocks = 1024;
 
+    // Number of blocks for size work items
+    unsigned int blocks(size_t size) const
+    {
+        return rocrand_host::detail::generator_blocks(size, s_threads, m_max_blocks);
+    }
+
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // Round keys of permutations and Latin hypercubes
+    permutation_manager m_permutation;
+
     // m_seed from base_type
     // m_offset from base_type
 };
@@ -0,0 +1,159 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PREFETCHER_H_
+#define ROCRAND_RNG_PREFETCHER_H_
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "memory_pool.hpp"
+
+// Keeps blocks of random numbers generated ahead of time in pinned host
+// buffers for consumers on the host.
+//
+// Every block is generated into device memory and copied to its host buffer
+// on the generator's stream, an event marks when it is ready. A block is
+// refilled when the consumer asks for the next one, so generation of
+// the following blocks overlaps with consumption and the consumer waits
+// only if it is faster than the device.
+struct rocrand_prefetcher_base_type
+{
+    rocrand_prefetcher_base_type(rocrand_generator generator,
+                                 size_t block_size,
+                                 unsigned int blocks)
+        : m_generator(generator), m_block_size(block_size),
+          m_device(NULL), m_current(0), m_held(false)
+    {
+        if(rocrand_host::detail::pool_malloc(
+            &m_device, sizeof(unsigned int) * m_block_size, m_generator->get_stream()) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        for(unsigned int i = 0; i < blocks; i++)
+        {
+            unsigned int * host;
+            hipEvent_t ready;
+            if(hipHostMalloc(&host, sizeof(unsigned int) * m_block_size, hipHostMallocDefault) != hipSuccess)
+            {
+                release();
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipEventCreateWithFlags(&ready, hipEventDisableTiming) != hipSuccess)
+            {
+                hipHostFree(host);
+                release();
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_host.push_back(host);
+            m_ready.push_back(ready);
+        }
+    }
+
+    ~rocrand_prefetcher_base_type()
+    {
+        release();
+    }
+
+    // Starts generation of all blocks
+    rocrand_status init()
+    {
+        for(unsigned int i = 0; i < m_host.size(); i++)
+        {
+            rocrand_status status = fill(i);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        m_current = m_host.size() - 1;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Returns the next block, the previous one is refilled (its data must
+    // not be used after this call).
+    // If the refill fails the previous block stays held and the refill is
+    // retried by the next call, so a block is never returned before it is
+    // filled with new values.
+    rocrand_status next_block(const unsigned int ** block, size_t * size)
+    {
+        if(m_held)
+        {
+            rocrand_status status = fill(m_current);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            m_held = false;
+        }
+        const size_t next = (m_current + 1) % m_host.size();
+        if(hipEventSynchronize(m_ready[next]) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        m_current = next;
+        m_held = true;
+        *block = m_host[m_current];
+        *size = m_block_size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+
+    rocrand_status fill(const unsigned int i)
+    {
+        hipStream_t stream = m_generator->get_stream();
+        rocrand_status status = rocrand_generate(m_generator, m_device, m_block_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(m_host[i], m_device, sizeof(unsigned int) * m_block_size,
+                          hipMemcpyDeviceToHost, stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        if(hipEventRecord(m_ready[i], stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void release()
+    {
+        // Copies in flight write to host buffers
+        for(size_t i = 0; i < m_host.size(); i++)
+        {
+            hipEventSynchronize(m_ready[i]);
+            hipEventDestroy(m_ready[i]);
+            hipHostFree(m_host[i]);
+        }
+        m_ready.clear();
+        m_host.clear();
+        rocrand_host::detail::pool_free(m_device, m_generator->get_stream());
+        m_device = NULL;
+    }
+
+    rocrand_generator m_generator;
+    size_t m_block_size;
+    // Pinned host buffers and events which mark when they are filled
+    std::vector<unsigned int *> m_host;
+    std::vector<hipEvent_t> m_ready;
+    unsigned int * m_device;
+    // Block returned by the last next_block() call
+    size_t m_current;
+    // The consumer may still use the current block
+    bool m_held;
+};
+
+#endif // ROCRAND_RNG_PREFETCHER_H_
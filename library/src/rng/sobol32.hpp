@@ -30,15 +30,18 @@
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "output.hpp"
+#include "memory_pool.hpp"
+#include "launch_tuner.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
     typedef ::rocrand_device::sobol32_engine<true> sobol32_device_engine;
 
-    template<class Type, class Distribution>
+    template<class Output, class Distribution>
     __global__
-    void generate_kernel(Type * data, const size_t n,
+    void generate_kernel(Output data, const size_t n,
                          const unsigned int * direction_vectors,
                          const unsigned int offset,
                          Distribution distribution)
@@ -68,6 +71,228 @@ namespace detail {
         }
     }
 
+    template<class Distribution>
+    __global__
+    void generate_poisson_array_kernel(unsigned int * data,
+                                       const double * lambdas,
+                                       const size_t n,
+                                       const unsigned int * direction_vectors,
+                                       const unsigned int offset,
+                                       Distribution distribution)
+    {
+        const unsigned int dimension = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ unsigned int vectors[32];
+        if (hipThreadIdx_x < 32)
+        {
+            vectors[hipThreadIdx_x] = direction_vectors[dimension * 32 + hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        sobol32_device_engine engine(vectors, offset + engine_id);
+
+        // Inversion keeps one point of the sequence per sample
+        const unsigned int start = dimension * n;
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            data[start + index] = distribution(engine.current(), lambdas[start + index]);
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+    template<class Distribution>
+    __global__
+    void generate_bernoulli_bits_kernel(unsigned int * data, const size_t n,
+                                        const unsigned int * direction_vectors,
+                                        const unsigned int offset,
+                                        Distribution distribution)
+    {
+        const unsigned int dimension = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ unsigned int vectors[32];
+        if (hipThreadIdx_x < 32)
+        {
+            vectors[hipThreadIdx_x] = direction_vectors[dimension * 32 + hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        // Each word contains bits of 32 consecutive points
+        const unsigned int start = dimension * n;
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            sobol32_device_engine engine(vectors, offset + index * 32);
+            unsigned int word = 0;
+            for(unsigned int i = 0; i < 32; i++)
+            {
+                word |= distribution.bit(engine.current()) << i;
+                engine.discard();
+            }
+            data[start + index] = word;
+            index += stride;
+        }
+    }
+
+    // Returns values of consecutive dimensions of one point, so a point can be
+    // used as an engine by distributions. Values past the last dimension are 0.
+    struct sobol32_point_engine
+    {
+        const unsigned int * direction_vectors;
+        const unsigned int dimensions;
+        const unsigned int point;
+        unsigned int dimension;
+
+        __forceinline__ __device__
+        sobol32_point_engine(const unsigned int * direction_vectors,
+                             const unsigned int dimensions,
+                             const unsigned int point)
+            : direction_vectors(direction_vectors), dimensions(dimensions),
+              point(point), dimension(0) {}
+
+        __forceinline__ __device__
+        unsigned int operator()()
+        {
+            if(dimension >= dimensions)
+                return 0;
+            sobol32_device_engine engine(direction_vectors + dimension * 32, point);
+            dimension++;
+            return engine.current();
+        }
+    };
+
+    // Normal values of two dimensions of a point, each one is computed by
+    // inversion (Box-Muller would mix dimensions)
+    struct sobol32_normal_pair
+    {
+        __forceinline__ __host__ __device__
+        float2 operator()(const unsigned int x, const unsigned int y)
+        {
+            normal_distribution<float> normal;
+            return float2 { normal(x), normal(y) };
+        }
+    };
+
+    // Each vector is a point of the sequence, its independent normal values
+    // are taken from all dimensions
+    template<class Distribution>
+    __global__
+    void generate_multivariate_normal_kernel(float * data, const size_t n,
+                                             const unsigned int * direction_vectors,
+                                             const unsigned int offset,
+                                             const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        __shared__ float factor[Distribution::shared_factor_size];
+        distribution.load(factor);
+
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            sobol32_point_engine engine(direction_vectors, distribution.dimensions, offset + index);
+            distribution(engine, data + index, n, factor);
+            index += stride;
+        }
+    }
+
+    // Values of paths staged in shared memory
+    const unsigned int brownian_paths_tile_size = 4096;
+    // Consecutive points of a dimension generated by one thread
+    const unsigned int brownian_paths_run = 16;
+
+    // Tiles of at least one run of paths are staged in shared memory,
+    // longer paths are staged in the output
+    __forceinline__ __host__ __device__
+    bool brownian_paths_shared(const unsigned int steps)
+    {
+        return steps * brownian_paths_run <= brownian_paths_tile_size;
+    }
+
+    // Number of paths of a tile
+    __forceinline__ __host__ __device__
+    unsigned int brownian_paths_tile(const unsigned int steps, const unsigned int threads)
+    {
+        return brownian_paths_shared(steps) ? brownian_paths_tile_size / steps : threads;
+    }
+
+    // Each path is a point of the sequence, the k-th dimension gives the normal
+    // value of the k-th step of the Brownian bridge. A block builds tiles of
+    // consecutive paths:
+    //  * normal values are generated by runs of consecutive points of one
+    //    dimension, so the engine advances by Gray code steps, and stored at the
+    //    points they build;
+    //  * every thread builds its paths in place;
+    //  * paths of a tile are contiguous in the path-major output, so the tile is
+    //    written coalesced.
+    template<class Distribution>
+    __global__
+    void generate_brownian_paths_kernel(float * data, const size_t n,
+                                        const unsigned int * direction_vectors,
+                                        const unsigned int offset,
+                                        const Distribution distribution)
+    {
+        __shared__ float tile[brownian_paths_tile_size];
+
+        const unsigned int steps = distribution.steps;
+        const bool shared_tile = brownian_paths_shared(steps);
+        const unsigned int tile_paths = brownian_paths_tile(steps, hipBlockDim_x);
+        const unsigned int runs = (tile_paths + brownian_paths_run - 1) / brownian_paths_run;
+
+        normal_distribution<float> normal;
+        for(size_t first = static_cast<size_t>(hipBlockIdx_x) * tile_paths; first < n;
+            first += static_cast<size_t>(hipGridDim_x) * tile_paths)
+        {
+            const unsigned int count = static_cast<unsigned int>(
+                n - first < tile_paths ? n - first : tile_paths
+            );
+            float * output = data + first * steps;
+            float * paths = shared_tile ? tile : output;
+
+            for(unsigned int i = hipThreadIdx_x; i < steps * runs; i += hipBlockDim_x)
+            {
+                const unsigned int k = i / runs;
+                const unsigned int begin = (i % runs) * brownian_paths_run;
+                if(begin >= count)
+                    continue;
+                const unsigned int end = begin + brownian_paths_run < count
+                    ? begin + brownian_paths_run : count;
+                const unsigned int index = distribution.schedule[k].index;
+                sobol32_device_engine engine(
+                    direction_vectors + k * 32,
+                    offset + static_cast<unsigned int>(first) + begin
+                );
+                for(unsigned int j = begin; j < end; j++)
+                {
+                    paths[j * steps + index] = normal(engine.current());
+                    engine.discard();
+                }
+            }
+            __syncthreads();
+
+            for(unsigned int j = hipThreadIdx_x; j < count; j += hipBlockDim_x)
+            {
+                distribution.build(paths + j * steps);
+            }
+            __syncthreads();
+
+            if(shared_tile)
+            {
+                for(unsigned int i = hipThreadIdx_x; i < count * steps; i += hipBlockDim_x)
+                {
+                    output[i] = tile[i];
+                }
+                __syncthreads();
+            }
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -85,7 +310,7 @@ public:
     {
         // Allocate direction vectors
         hipError_t error;
-        error = hipMalloc(&m_direction_vectors, sizeof(unsigned int) * SOBOL_N);
+        error = rocrand_host::detail::pool_malloc(&m_direction_vectors, sizeof(unsigned int) * SOBOL_N, m_stream);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -99,7 +324,7 @@ public:
 
     ~rocrand_sobol32()
     {
-        hipFree(m_direction_vectors);
+        rocrand_host::detail::pool_free(m_direction_vectors, m_stream);
     }
 
     void reset()
@@ -119,6 +344,16 @@ public:
         m_initialized = false;
     }
 
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        if(order != ROCRAND_ORDERING_QUASI_DEFAULT)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_initialized)
@@ -130,8 +365,9 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
+    template<class Output,
+             class Distribution = uniform_distribution<typename rocrand_host::detail::output_value<Output>::type> >
+    rocrand_status generate(Output data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
         if (data_size % m_dimensions != 0)
@@ -156,48 +392,175 @@ public:
         // supports only power of 2 jumps
         const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
         const uint32_t blocks_y = m_dimensions;
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
-            data, size,
-            m_direction_vectors, m_current_offset,
-            distribution
+        status = rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate", size, blocks_x * threads, threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                    dim3(grid, blocks_y), dim3(block), 0, m_stream,
+                    data, size,
+                    m_direction_vectors, m_current_offset,
+                    distribution
+                );
+            }
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
         m_current_offset += size;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    template<class Output>
+    rocrand_status generate_uniform(Output data, size_t data_size)
     {
+        typedef typename rocrand_host::detail::output_value<Output>::type T;
         uniform_distribution<T> distribution;
         return generate(data, data_size, distribution);
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_normal(Output data, size_t data_size, T mean, T stddev)
     {
         normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    template<class Output, class T>
+    rocrand_status generate_log_normal(Output data, size_t data_size, T mean, T stddev)
     {
         log_normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
+    // One value per point: lower bits of a point are not quasi-random
+    // The inverse CDF method is used for all intervals: rejection sampling
+    // would break the correspondence between points and values
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size, T mean, T stddev,
+                                             T lower, T upper)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class Format>
+    rocrand_status generate_uniform_16(unsigned short * data, size_t data_size)
+    {
+        float16_distribution<Format, uniform_distribution<float> > distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class Format>
+    rocrand_status generate_normal_16(unsigned short * data, size_t data_size, float mean, float stddev)
+    {
+        float16_distribution<Format, normal_distribution<float> > distribution(
+            normal_distribution<float>(mean, stddev)
+        );
+        return generate(data, data_size, distribution);
+    }
+
+    // Each vector uses all dimensions of a point, so dimensions must be
+    // equal to the dimension of the generator
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const float * mean, const float * factor)
+    {
+        if (dimensions != m_dimensions)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return rocrand_host::detail::dispatch_multivariate_normal<rocrand_host::detail::sobol32_normal_pair>(
+            *this, data, n_vectors, dimensions, mean, factor
+        );
+    }
+
+    // Used by dispatch_multivariate_normal
+    template<class Distribution>
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                const Distribution& distribution)
+    {
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((n_vectors + threads - 1) / threads));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, n_vectors,
+            m_direction_vectors, m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += n_vectors;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Paths use all dimensions of a point, so steps must be equal to
+    // the dimension of the generator
+    rocrand_status generate_brownian_paths(float * data, size_t n_paths,
+                                           unsigned int steps,
+                                           const float * times,
+                                           const unsigned int * ordering)
+    {
+        if (steps != m_dimensions)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = m_bridge.set(steps, times, ordering, m_stream);
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const uint32_t tile_paths = rocrand_host::detail::brownian_paths_tile(steps, threads);
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((n_paths + tile_paths - 1) / tile_paths));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_brownian_paths_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, n_paths,
+            m_direction_vectors, m_current_offset,
+            m_bridge.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += n_paths;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
@@ -206,6 +569,107 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_poisson_array(unsigned int * data, const double * lambdas, size_t data_size)
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+
+        poisson_array_distribution distribution;
+
+        status = rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_poisson_array", size, blocks_x * threads, threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel),
+                    dim3(grid, blocks_y), dim3(block), 0, m_stream,
+                    data, lambdas, size,
+                    m_direction_vectors, m_current_offset,
+                    distribution
+                );
+            }
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Bits of a word are taken from 32 consecutive points of the same dimension,
+    // p = 0.5 is not special: lower bits of a point are not quasi-random
+    rocrand_status generate_bernoulli_bits(unsigned int * data, size_t n_bits, double p)
+    {
+        if (n_bits % (32 * m_dimensions) != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        #ifdef __HIP_PLATFORM_NVCC__
+        const uint32_t threads = 64;
+        const uint32_t max_blocks = 4096;
+        #else
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        #endif
+
+        const size_t size = n_bits / (32 * m_dimensions);
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+
+        bernoulli_bits_distribution<> distribution(p);
+
+        status = rocrand_host::detail::tuned_launch<decltype(data), decltype(distribution)>(
+            rng_type, "generate_bernoulli_bits", size, blocks_x * threads, threads, m_stream,
+            [&](unsigned int grid, unsigned int block)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_bernoulli_bits_kernel),
+                    dim3(grid, blocks_y), dim3(block), 0, m_stream,
+                    data, size,
+                    m_direction_vectors, m_current_offset,
+                    distribution
+                );
+            }
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_current_offset += size * 32;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF>& get_poisson_manager()
+    {
+        return m_poisson;
+    }
+
 private:
     bool m_initialized;
     unsigned int m_dimensions;
@@ -214,6 +678,8 @@ private:
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+    // Construction schedule of the last generated Brownian paths
+    brownian_bridge_manager m_bridge;
 
     // m_offset from base_type
 
@@ -23,7 +23,236 @@
 #include "rng/generators.hpp"
 
 #include <rocrand.h>
+#include <algorithm>
 #include <new>
+#include <vector>
+
+// Points on spheres, in balls and on simplices
+static rocrand_status
+generate_sphere(rocrand_generator generator,
+                float * output_data, size_t n,
+                unsigned int dimensions, sphere_shape shape)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dimensions == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_sphere(output_data, n,
+                                                        dimensions, shape);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_sphere(output_data, n,
+                                                   dimensions, shape);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_sphere(output_data, n,
+                                                         dimensions, shape);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_sphere(output_data, n,
+                                                         dimensions, shape);
+    }
+    // Dimensions of quasi-random points do not match values used by points
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+// Generation methods used by strided and pitched outputs
+struct generate_method
+{
+    template<class Generator, class Output>
+    rocrand_status operator()(Generator * generator, Output output, size_t n) const
+    {
+        return generator->generate(output, n);
+    }
+};
+
+struct generate_uniform_method
+{
+    template<class Generator, class Output>
+    rocrand_status operator()(Generator * generator, Output output, size_t n) const
+    {
+        return generator->generate_uniform(output, n);
+    }
+};
+
+template<class T>
+struct generate_normal_method
+{
+    T mean;
+    T stddev;
+
+    template<class Generator, class Output>
+    rocrand_status operator()(Generator * generator, Output output, size_t n) const
+    {
+        return generator->generate_normal(output, n, mean, stddev);
+    }
+};
+
+template<class T>
+struct generate_log_normal_method
+{
+    T mean;
+    T stddev;
+
+    template<class Generator, class Output>
+    rocrand_status operator()(Generator * generator, Output output, size_t n) const
+    {
+        return generator->generate_log_normal(output, n, mean, stddev);
+    }
+};
+
+// Writes width * height values with the same sequence as the dense output,
+// value i is stored at output_data[(i / width) * pitch + (i % width) * stride]
+template<class T, class Method>
+static rocrand_status
+generate_strided(rocrand_generator generator,
+                 T * output_data,
+                 size_t width, size_t height,
+                 size_t stride, size_t pitch,
+                 Method method)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Values must not overlap
+    if(stride == 0 || (height > 1 && width > 0 && pitch < (width - 1) * stride + 1))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const strided_output<T> output(output_data, width, stride, height > 1 ? pitch : 0);
+    const size_t n = width * height;
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return method(static_cast<rocrand_philox4x32_10 *>(generator), output, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return method(static_cast<rocrand_mrg32k3a *>(generator), output, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return method(static_cast<rocrand_xorwow *>(generator), output, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return method(static_cast<rocrand_sobol32 *>(generator), output, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return method(static_cast<rocrand_mtgp32 *>(generator), output, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+// Builds tables of a distribution with the given method and copies
+// the structure to device memory
+template<rocrand_discrete_method Method>
+static rocrand_status
+create_poisson_distribution(double lambda,
+                            rocrand_discrete_distribution * discrete_distribution)
+{
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_poisson_distribution<Method> h_dis;
+    try
+    {
+        h_dis = rocrand_poisson_distribution<Method>(lambda);
+    }
+    catch(const std::exception& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+
+    hipError_t error;
+    error = rocrand_host::detail::pool_malloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+template<rocrand_discrete_method Method>
+static rocrand_status
+create_discrete_distribution(const double * probabilities,
+                             unsigned int size,
+                             unsigned int offset,
+                             rocrand_discrete_distribution * discrete_distribution)
+{
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<Method> h_dis;
+    try
+    {
+        h_dis = rocrand_discrete_distribution_base<Method>(probabilities, size, offset);
+    }
+    catch(const std::exception& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+
+    hipError_t error;
+    error = rocrand_host::detail::pool_malloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
 
 #if defined(__cplusplus)
 extern "C" {
@@ -34,6 +263,9 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 {
     try
     {
+        // Tuned launch geometry of previous runs
+        rocrand_host::detail::launch_tuner::instance().load();
+
         if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
         {
             *generator = new rocrand_philox4x32_10();
@@ -86,6 +318,73 @@ rocrand_destroy_generator(rocrand_generator generator)
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_prefetcher(rocrand_prefetcher * prefetcher,
+                          rocrand_generator generator,
+                          size_t block_size,
+                          unsigned int blocks)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(prefetcher == NULL || block_size == 0 || blocks < 2)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_prefetcher p = NULL;
+    try
+    {
+        p = new rocrand_prefetcher_base_type(generator, block_size, blocks);
+        rocrand_status status = p->init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            delete p;
+            return status;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    *prefetcher = p;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_next_block(rocrand_prefetcher prefetcher,
+                   const unsigned int ** block,
+                   size_t * n)
+{
+    if(prefetcher == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(block == NULL || n == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return prefetcher->next_block(block, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_prefetcher(rocrand_prefetcher prefetcher)
+{
+    if(prefetcher == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    delete prefetcher;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n)
@@ -128,6 +427,91 @@ rocrand_generate(rocrand_generator generator,
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_generate_batched(rocrand_generator * generators,
+                         unsigned int ** output_data,
+                         const size_t * n,
+                         unsigned int count)
+{
+    if(count == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generators == NULL || output_data == NULL || n == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    for(unsigned int i = 0; i < count; i++)
+    {
+        if(generators[i] == NULL)
+        {
+            return ROCRAND_STATUS_NOT_CREATED;
+        }
+    }
+
+    // One launch is possible only for distinct generators of the same type
+    // which use the same stream
+    const rocrand_rng_type rng_type = generators[0]->rng_type;
+    const hipStream_t stream = generators[0]->get_stream();
+    bool batched = rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        || rng_type == ROCRAND_RNG_PSEUDO_XORWOW;
+    for(unsigned int i = 1; i < count && batched; i++)
+    {
+        batched = generators[i]->rng_type == rng_type
+            && generators[i]->get_stream() == stream;
+    }
+    if(batched)
+    {
+        std::vector<rocrand_generator> sorted(generators, generators + count);
+        std::sort(sorted.begin(), sorted.end());
+        batched = std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+    }
+
+    if(!batched)
+    {
+        for(unsigned int i = 0; i < count; i++)
+        {
+            rocrand_status status = rocrand_generate(generators[i], output_data[i], n[i]);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    try
+    {
+        // Pointers to derived objects are converted one by one
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            std::vector<rocrand_philox4x32_10 *> philox4x32_10_generators(count);
+            for(unsigned int i = 0; i < count; i++)
+            {
+                philox4x32_10_generators[i] = static_cast<rocrand_philox4x32_10 *>(generators[i]);
+            }
+            return rocrand_philox4x32_10::generate_batched(
+                philox4x32_10_generators.data(), output_data, n, count
+            );
+        }
+        else
+        {
+            std::vector<rocrand_xorwow *> xorwow_generators(count);
+            for(unsigned int i = 0; i < count; i++)
+            {
+                xorwow_generators[i] = static_cast<rocrand_xorwow *>(generators[i]);
+            }
+            return rocrand_xorwow::generate_batched(
+                xorwow_generators.data(), output_data, n, count
+            );
+        }
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+}
+
 rocrand_status ROCRANDAPI
 rocrand_generate_uniform(rocrand_generator generator,
                          float * output_data, size_t n)
@@ -405,59 +789,50 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda)
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              unsigned short * output_data, size_t n)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
-    {
-        return ROCRAND_STATUS_OUT_OF_RANGE;
-    }
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n,
-                                                         lambda);
+        return philox4x32_10_generator->generate_uniform_16<half_format>(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a * mrg32k3a_generator =
             static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n,
-                                                    lambda);
+        return mrg32k3a_generator->generate_uniform_16<half_format>(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow * rocrand_xorwow_generator =
             static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return rocrand_xorwow_generator->generate_uniform_16<half_format>(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n,
-                                                           lambda);
+        return rocrand_sobol32_generator->generate_uniform_16<half_format>(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
         rocrand_mtgp32 * rocrand_mtgp32_generator =
             static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return rocrand_mtgp32_generator->generate_uniform_16<half_format>(output_data, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator)
+rocrand_generate_uniform_bf16(rocrand_generator generator,
+                              unsigned short * output_data, size_t n)
 {
     if(generator == NULL)
     {
@@ -466,29 +841,663 @@ rocrand_initialize_generator(rocrand_generator generator)
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_16<bfloat16_format>(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform_16<bfloat16_format>(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform_16<bfloat16_format>(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform_16<bfloat16_format>(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform_16<bfloat16_format>(output_data, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             unsigned short * output_data, size_t n,
+                             float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal_16<half_format>(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal_16<half_format>(output_data, n,
+                                                                   mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal_16<half_format>(output_data, n,
+                                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal_16<half_format>(output_data, n,
+                                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal_16<half_format>(output_data, n,
+                                                                         mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_bf16(rocrand_generator generator,
+                             unsigned short * output_data, size_t n,
+                             float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal_16<bfloat16_format>(output_data, n,
+                                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal_16<bfloat16_format>(output_data, n,
+                                                                       mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal_16<bfloat16_format>(output_data, n,
+                                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal_16<bfloat16_format>(output_data, n,
+                                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal_16<bfloat16_format>(output_data, n,
+                                                                             mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lower, float upper)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(stddev > 0) || !(lower < upper))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_truncated_normal(output_data, n,
+                                                                  mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_truncated_normal(output_data, n,
+                                                             mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_truncated_normal(output_data, n,
+                                                                   mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_truncated_normal(output_data, n,
+                                                                    mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_truncated_normal(output_data, n,
+                                                                   mean, stddev, lower, upper);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lower, double upper)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(stddev > 0) || !(lower < upper))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_truncated_normal(output_data, n,
+                                                                  mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_truncated_normal(output_data, n,
+                                                             mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_truncated_normal(output_data, n,
+                                                                   mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_truncated_normal(output_data, n,
+                                                                    mean, stddev, lower, upper);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_truncated_normal(output_data, n,
+                                                                   mean, stddev, lower, upper);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_strided(rocrand_generator generator,
+                         unsigned int * output_data,
+                         size_t width, size_t height,
+                         size_t stride, size_t pitch)
+{
+    return generate_strided(generator, output_data, width, height, stride, pitch,
+                            generate_method());
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_strided(rocrand_generator generator,
+                                 float * output_data,
+                                 size_t width, size_t height,
+                                 size_t stride, size_t pitch)
+{
+    return generate_strided(generator, output_data, width, height, stride, pitch,
+                            generate_uniform_method());
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_strided(rocrand_generator generator,
+                                        double * output_data,
+                                        size_t width, size_t height,
+                                        size_t stride, size_t pitch)
+{
+    return generate_strided(generator, output_data, width, height, stride, pitch,
+                            generate_uniform_method());
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_strided(rocrand_generator generator,
+                                float * output_data,
+                                size_t width, size_t height,
+                                size_t stride, size_t pitch,
+                                float mean, float stddev)
+{
+    const generate_normal_method<float> method = { mean, stddev };
+    return generate_strided(generator, output_data, width, height, stride, pitch, method);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_strided(rocrand_generator generator,
+                                       double * output_data,
+                                       size_t width, size_t height,
+                                       size_t stride, size_t pitch,
+                                       double mean, double stddev)
+{
+    const generate_normal_method<double> method = { mean, stddev };
+    return generate_strided(generator, output_data, width, height, stride, pitch, method);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_strided(rocrand_generator generator,
+                                    float * output_data,
+                                    size_t width, size_t height,
+                                    size_t stride, size_t pitch,
+                                    float mean, float stddev)
+{
+    const generate_log_normal_method<float> method = { mean, stddev };
+    return generate_strided(generator, output_data, width, height, stride, pitch, method);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double_strided(rocrand_generator generator,
+                                           double * output_data,
+                                           size_t width, size_t height,
+                                           size_t stride, size_t pitch,
+                                           double mean, double stddev)
+{
+    const generate_log_normal_method<double> method = { mean, stddev };
+    return generate_strided(generator, output_data, width, height, stride, pitch, method);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n_vectors,
+                                     unsigned int dimensions,
+                                     const float * mean, const float * factor)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dimensions == 0 || factor == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                     dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                      dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                       dimensions, mean, factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                      dimensions, mean, factor);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_paths(rocrand_generator generator,
+                                float * output_data, size_t n_paths,
+                                unsigned int steps,
+                                const float * times,
+                                const unsigned int * ordering)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(steps == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_brownian_paths(output_data, n_paths,
+                                                                 steps, times, ordering);
+    }
+    // The bridge is useful only for quasi-random points, pseudo-random paths
+    // can be built from rocrand_generate_normal() by cumulative sums
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_bits(rocrand_generator generator,
+                                unsigned int * output_data, size_t n_bits,
+                                double p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_bernoulli_bits(output_data, n_bits, p);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data, size_t n)
+{
+    return rocrand_sample_without_replacement(generator, output_data, n, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   size_t k, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(k > n || static_cast<unsigned long long>(n) > (1ULL << 32))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_permutation(output_data, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_permutation(output_data, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_permutation(output_data, k, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_permutation(output_data, k, n);
+    }
+    // Quasi-random sequences are not suitable for permutations
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                 float * output_data, size_t n_points,
+                                 unsigned int dimensions)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Strata narrower than 2^-24 may contain no float values
+    if(dimensions == 0 || static_cast<unsigned long long>(n_points) > (1ULL << 24))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_latin_hypercube(output_data, n_points,
+                                                                 dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_latin_hypercube(output_data, n_points,
+                                                            dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_latin_hypercube(output_data, n_points,
+                                                                  dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_latin_hypercube(output_data, n_points,
+                                                                  dimensions);
+    }
+    // Quasi-random points are already stratified
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_sphere(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        unsigned int dimensions)
+{
+    return generate_sphere(generator, output_data, n, dimensions, SPHERE_SHAPE_SPHERE);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_ball(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      unsigned int dimensions)
+{
+    return generate_sphere(generator, output_data, n, dimensions, SPHERE_SHAPE_BALL);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_simplex(rocrand_generator generator,
+                         float * output_data, size_t n,
+                         unsigned int dimensions)
+{
+    return generate_sphere(generator, output_data, n, dimensions, SPHERE_SHAPE_SIMPLEX);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_poisson(output_data, n,
+                                                    lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas,
+                               size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(n > 0 && lambdas == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_poisson_array(output_data, lambdas, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_poisson_array(output_data, lambdas, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        return static_cast<rocrand_xorwow *>(generator)->init();
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_poisson_array(output_data, lambdas, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        return static_cast<rocrand_sobol32 *>(generator)->init();
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_poisson_array(output_data, lambdas, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        return static_cast<rocrand_mtgp32 *>(generator)->init();
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_poisson_array(output_data, lambdas, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+rocrand_initialize_generator(rocrand_generator generator)
 {
     if(generator == NULL)
     {
@@ -497,28 +1506,66 @@ rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_mrg32k3a *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_xorwow *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_sobol32 *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_mtgp32 *>(generator)->init();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    try
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+    }
+    catch(rocrand_status status)
+    {
+        return status;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
@@ -594,6 +1641,58 @@ rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_order(order);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_engine_cache_size(rocrand_generator generator, unsigned int entries)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_engine_cache_size(entries);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_engine_cache_size(entries);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                               unsigned int dimensions)
@@ -628,91 +1727,190 @@ rocrand_get_version(int * version)
 }
 
 rocrand_status ROCRANDAPI
-rocrand_create_poisson_distribution(double lambda,
-                                    rocrand_discrete_distribution * discrete_distribution)
+rocrand_set_poisson_cache_limits(rocrand_generator generator,
+                                 unsigned int max_tables,
+                                 size_t max_bytes)
 {
-    if (discrete_distribution == NULL)
+    if(generator == NULL)
     {
-        return ROCRAND_STATUS_OUT_OF_RANGE;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
+    if(max_tables == 0)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
-    try
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        h_dis = rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL>(lambda);
+        static_cast<rocrand_philox4x32_10 *>(generator)->get_poisson_manager().set_limits(max_tables, max_bytes);
     }
-    catch(const std::exception& e)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        static_cast<rocrand_mrg32k3a *>(generator)->get_poisson_manager().set_limits(max_tables, max_bytes);
     }
-    catch(rocrand_status status)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        return status;
+        static_cast<rocrand_xorwow *>(generator)->get_poisson_manager().set_limits(max_tables, max_bytes);
     }
-
-    hipError_t error;
-    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
-    if (error != hipSuccess)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        return ROCRAND_STATUS_ALLOCATION_FAILED;
+        static_cast<rocrand_sobol32 *>(generator)->get_poisson_manager().set_limits(max_tables, max_bytes);
     }
-    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
-    if (error != hipSuccess)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        static_cast<rocrand_mtgp32 *>(generator)->get_poisson_manager().set_limits(max_tables, max_bytes);
+    }
+    else
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-
     return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_create_discrete_distribution(const double * probabilities,
-                                     unsigned int size,
-                                     unsigned int offset,
-                                     rocrand_discrete_distribution * discrete_distribution)
+rocrand_prewarm_poisson_cache(rocrand_generator generator,
+                              const double * lambdas,
+                              unsigned int count)
 {
-    if (discrete_distribution == NULL)
+    if(generator == NULL)
     {
-        return ROCRAND_STATUS_OUT_OF_RANGE;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (size == 0)
+    if(count > 0 && lambdas == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-
-    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
-    try
+    for(unsigned int i = 0; i < count; i++)
     {
-        h_dis = rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL>(probabilities, size, offset);
+        if(lambdas[i] <= 0.0)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
     }
-    catch(const std::exception& e)
+
+    try
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        for(unsigned int i = 0; i < count; i++)
+        {
+            if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+            {
+                static_cast<rocrand_philox4x32_10 *>(generator)->get_poisson_manager().prewarm(lambdas[i]);
+            }
+            else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+            {
+                static_cast<rocrand_mrg32k3a *>(generator)->get_poisson_manager().prewarm(lambdas[i]);
+            }
+            else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+            {
+                static_cast<rocrand_xorwow *>(generator)->get_poisson_manager().prewarm(lambdas[i]);
+            }
+            else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+            {
+                static_cast<rocrand_sobol32 *>(generator)->get_poisson_manager().prewarm(lambdas[i]);
+            }
+            else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+            {
+                static_cast<rocrand_mtgp32 *>(generator)->get_poisson_manager().prewarm(lambdas[i]);
+            }
+            else
+            {
+                return ROCRAND_STATUS_TYPE_ERROR;
+            }
+        }
     }
     catch(rocrand_status status)
     {
         return status;
     }
+    return ROCRAND_STATUS_SUCCESS;
+}
 
-    hipError_t error;
-    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
-    if (error != hipSuccess)
+rocrand_status ROCRANDAPI
+rocrand_get_poisson_cache_stats(rocrand_generator generator,
+                                unsigned long long * hits,
+                                unsigned long long * misses)
+{
+    if(generator == NULL)
     {
-        return ROCRAND_STATUS_ALLOCATION_FAILED;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
-    if (error != hipSuccess)
+    if(hits == NULL || misses == NULL)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        *hits = static_cast<rocrand_philox4x32_10 *>(generator)->get_poisson_manager().get_hits();
+        *misses = static_cast<rocrand_philox4x32_10 *>(generator)->get_poisson_manager().get_misses();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        *hits = static_cast<rocrand_mrg32k3a *>(generator)->get_poisson_manager().get_hits();
+        *misses = static_cast<rocrand_mrg32k3a *>(generator)->get_poisson_manager().get_misses();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        *hits = static_cast<rocrand_xorwow *>(generator)->get_poisson_manager().get_hits();
+        *misses = static_cast<rocrand_xorwow *>(generator)->get_poisson_manager().get_misses();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        *hits = static_cast<rocrand_sobol32 *>(generator)->get_poisson_manager().get_hits();
+        *misses = static_cast<rocrand_sobol32 *>(generator)->get_poisson_manager().get_misses();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        *hits = static_cast<rocrand_mtgp32 *>(generator)->get_poisson_manager().get_hits();
+        *misses = static_cast<rocrand_mtgp32 *>(generator)->get_poisson_manager().get_misses();
+    }
+    else
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_poisson_distribution(double lambda,
+                                    rocrand_discrete_distribution * discrete_distribution)
+{
+    return create_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL>(
+        lambda, discrete_distribution
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_poisson_distribution_compact(double lambda,
+                                            rocrand_discrete_distribution * discrete_distribution)
+{
+    return create_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL_COMPACT>(
+        lambda, discrete_distribution
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution(const double * probabilities,
+                                     unsigned int size,
+                                     unsigned int offset,
+                                     rocrand_discrete_distribution * discrete_distribution)
+{
+    return create_discrete_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL>(
+        probabilities, size, offset, discrete_distribution
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_compact(const double * probabilities,
+                                             unsigned int size,
+                                             unsigned int offset,
+                                             rocrand_discrete_distribution * discrete_distribution)
+{
+    return create_discrete_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL_COMPACT>(
+        probabilities, size, offset, discrete_distribution
+    );
+}
+
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution)
 {
@@ -730,6 +1928,16 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
         return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
+    // The distribution is owned by the user and may still be read by kernels
+    // on any stream (including non-blocking ones). The tables and the struct
+    // are returned to the memory pool instead of hipFree (which implicitly
+    // synchronizes), so wait for all work to finish before they can be reused.
+    error = hipDeviceSynchronize();
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
     try
     {
         h_dis.deallocate();
@@ -739,7 +1947,39 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
         return status;
     }
 
-    error = hipFree(discrete_distribution);
+    error = rocrand_host::detail::pool_free(discrete_distribution);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_memory_pool_limit(size_t max_bytes)
+{
+    hipError_t error;
+    error = rocrand_host::detail::memory_pool<rocrand_host::detail::device_memory>::instance()
+        .set_max_cached_bytes(max_bytes);
+    rocrand_host::detail::memory_pool<rocrand_host::detail::host_memory>::instance()
+        .set_max_cached_bytes(max_bytes);
+    rocrand_host::detail::staging_pool::instance().set_max_cached_bytes(max_bytes);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_trim_memory()
+{
+    hipError_t error;
+    error = rocrand_host::detail::memory_pool<rocrand_host::detail::device_memory>::instance().trim();
+    rocrand_host::detail::memory_pool<rocrand_host::detail::host_memory>::instance().trim();
+    rocrand_host::detail::staging_pool::instance().trim();
     if (error != hipSuccess)
     {
         return ROCRAND_STATUS_INTERNAL_ERROR;
@@ -748,6 +1988,34 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_set_tuning_mode(rocrand_tuning_mode mode)
+{
+    if(mode != ROCRAND_TUNING_DEFAULT
+       && mode != ROCRAND_TUNING_CACHED
+       && mode != ROCRAND_TUNING_AUTOTUNE)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::launch_tuner::instance().set_mode(mode);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_tuning_cache(const char * path)
+{
+    try
+    {
+        rocrand_host::detail::launch_tuner::instance().set_path(path != NULL ? path : "");
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
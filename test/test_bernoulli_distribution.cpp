@@ -0,0 +1,101 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <rng/distribution/bernoulli.hpp>
+
+struct mt19937_engine
+{
+    std::mt19937 gen;
+
+    mt19937_engine() : gen(std::random_device()()) { }
+
+    unsigned int operator()()
+    {
+        return gen();
+    }
+};
+
+TEST(bernoulli_distribution_tests, bit_test)
+{
+    bernoulli_bits_distribution<> half;
+    EXPECT_EQ(half.bit(0), 1U);
+    EXPECT_EQ(half.bit(0x7FFFFFFF), 1U);
+    EXPECT_EQ(half.bit(0x80000000), 0U);
+    EXPECT_EQ(half.bit(UINT_MAX), 0U);
+
+    bernoulli_bits_distribution<> zero(0.0);
+    EXPECT_EQ(zero.bit(0), 0U);
+    EXPECT_EQ(zero.bit(UINT_MAX), 0U);
+
+    bernoulli_bits_distribution<> one(1.0);
+    EXPECT_EQ(one.bit(0), 1U);
+    EXPECT_EQ(one.bit(UINT_MAX), 1U);
+}
+
+TEST(bernoulli_distribution_tests, word_test)
+{
+    mt19937_engine engine;
+
+    EXPECT_EQ(bernoulli_bits_distribution<>(0.0)(engine), 0U);
+    EXPECT_EQ(bernoulli_bits_distribution<>(1.0)(engine), UINT_MAX);
+
+    // Bits are stored in order of generated values
+    unsigned int values[32];
+    for(unsigned int i = 0; i < 32; i++)
+    {
+        values[i] = i % 3 == 0 ? 0U : UINT_MAX;
+    }
+    unsigned int position = 0;
+    auto sequence = [&]() { return values[position++]; };
+    const unsigned int word = bernoulli_bits_distribution<>(0.5)(sequence);
+    for(unsigned int i = 0; i < 32; i++)
+    {
+        EXPECT_EQ((word >> i) & 1U, i % 3 == 0 ? 1U : 0U);
+    }
+}
+
+TEST(bernoulli_distribution_tests, density_test)
+{
+    mt19937_engine engine;
+
+    const double ps[] = { 0.01, 0.1, 0.25, 0.5, 0.9 };
+    for(double p : ps)
+    {
+        bernoulli_bits_distribution<> distribution(p);
+
+        const size_t words = 10000;
+        size_t ones = 0;
+        for(size_t i = 0; i < words; i++)
+        {
+            unsigned int word = distribution(engine);
+            for(; word != 0; word &= word - 1)
+            {
+                ones++;
+            }
+        }
+        const double mean = static_cast<double>(ones) / (words * 32);
+        EXPECT_NEAR(mean, p, 0.01);
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <rng/distribution/brownian_bridge.hpp>
+
+class brownian_bridge_distribution_tests : public ::testing::TestWithParam<unsigned int> { };
+
+TEST_P(brownian_bridge_distribution_tests, bisection_test)
+{
+    const unsigned int steps = GetParam();
+    std::vector<unsigned int> ordering = rocrand_host::detail::brownian_bridge_bisection(steps);
+    ASSERT_EQ(ordering.size(), steps);
+    EXPECT_EQ(ordering[0], steps - 1);
+    std::sort(ordering.begin(), ordering.end());
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        EXPECT_EQ(ordering[i], i);
+    }
+}
+
+void check_covariance(const unsigned int steps,
+                      const float * times,
+                      const unsigned int * ordering)
+{
+    std::vector<brownian_bridge_step> schedule;
+    ASSERT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(steps, times, ordering, schedule),
+        ROCRAND_STATUS_SUCCESS
+    );
+    brownian_bridge_distribution distribution;
+    distribution.steps = steps;
+    distribution.schedule = schedule.data();
+
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> normal;
+    const size_t size = 50000;
+    std::vector<float> path(steps);
+    std::vector<double> sums(steps * steps, 0.0);
+    for(size_t i = 0; i < size; i++)
+    {
+        for(unsigned int k = 0; k < steps; k++)
+        {
+            distribution(k, normal(gen), path.data());
+        }
+        for(unsigned int a = 0; a < steps; a++)
+        {
+            for(unsigned int b = 0; b < steps; b++)
+            {
+                sums[a * steps + b] += path[a] * path[b];
+            }
+        }
+    }
+
+    // cov(W(s), W(t)) = min(s, t)
+    for(unsigned int a = 0; a < steps; a++)
+    {
+        for(unsigned int b = 0; b < steps; b++)
+        {
+            const double ta = times == NULL ? a + 1.0 : times[a];
+            const double tb = times == NULL ? b + 1.0 : times[b];
+            const double expected = std::min(ta, tb);
+            EXPECT_NEAR(sums[a * steps + b] / size, expected, 0.03 * std::max(ta, tb));
+        }
+    }
+}
+
+TEST_P(brownian_bridge_distribution_tests, covariance_test)
+{
+    check_covariance(GetParam(), NULL, NULL);
+}
+
+// Paths built in place from normal values stored at the points of their
+// steps are the same as paths built step by step
+TEST_P(brownian_bridge_distribution_tests, build_test)
+{
+    const unsigned int steps = GetParam();
+    std::vector<brownian_bridge_step> schedule;
+    ASSERT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(steps, NULL, NULL, schedule),
+        ROCRAND_STATUS_SUCCESS
+    );
+    brownian_bridge_distribution distribution;
+    distribution.steps = steps;
+    distribution.schedule = schedule.data();
+
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> normal;
+    std::vector<float> z(steps);
+    for(float& v : z) v = normal(gen);
+
+    std::vector<float> expected(steps);
+    std::vector<float> path(steps);
+    for(unsigned int k = 0; k < steps; k++)
+    {
+        distribution(k, z[k], expected.data());
+        path[schedule[k].index] = z[k];
+    }
+    distribution.build(path.data());
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        EXPECT_EQ(path[i], expected[i]);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(brownian_bridge_distribution_tests,
+                        brownian_bridge_distribution_tests,
+                        ::testing::Values(1, 2, 3, 8, 13));
+
+TEST(brownian_bridge_distribution_tests, custom_covariance_test)
+{
+    const float times[] = { 0.1f, 0.25f, 0.3f, 0.7f, 1.5f };
+    const unsigned int ordering[] = { 2, 4, 0, 3, 1 };
+    check_covariance(5, times, ordering);
+    // Forward ordering is the standard construction
+    const unsigned int forward[] = { 0, 1, 2, 3, 4 };
+    check_covariance(5, times, forward);
+}
+
+TEST(brownian_bridge_distribution_tests, invalid_test)
+{
+    std::vector<brownian_bridge_step> schedule;
+    const float times[] = { 1.0f, 2.0f, 2.0f };
+    const float negative_times[] = { 0.0f, 1.0f, 2.0f };
+    const unsigned int ordering[] = { 0, 2, 0 };
+    const unsigned int large_ordering[] = { 0, 1, 3 };
+    EXPECT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(0, NULL, NULL, schedule),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(3, times, NULL, schedule),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(3, negative_times, NULL, schedule),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(3, NULL, ordering, schedule),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_host::detail::brownian_bridge_schedule(3, NULL, large_ordering, schedule),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+}
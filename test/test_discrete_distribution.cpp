@@ -0,0 +1,208 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <rng/distribution/discrete.hpp>
+
+typedef rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL, true> host_discrete_distribution;
+typedef rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS, true> host_alias_distribution;
+typedef rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL_COMPACT, true> host_compact_distribution;
+
+std::vector<double> get_probabilities(const unsigned int size, const unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> p(size);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        // Mix of very light, average and very heavy items
+        const double u = uniform(gen);
+        p[i] = i % 97 == 0 ? u * 50.0 : (i % 3 == 0 ? u * 1e-3 : u);
+    }
+    return p;
+}
+
+class discrete_distribution_tests : public ::testing::TestWithParam<unsigned int> { };
+
+TEST_P(discrete_distribution_tests, alias_table)
+{
+    const unsigned int size = GetParam();
+
+    std::vector<double> p = get_probabilities(size, size);
+    double sum = 0.0;
+    for (double v : p)
+    {
+        sum += v;
+    }
+
+    host_alias_distribution dis(p.data(), size, 0);
+
+    // Restore probabilities from the alias table
+    std::vector<double> restored(size, 0.0);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        ASSERT_GE(dis.probability[i], 0.0);
+        ASSERT_LE(dis.probability[i], 1.0);
+        ASSERT_LT(dis.alias[i], size);
+        restored[i] += dis.probability[i] / size;
+        restored[dis.alias[i]] += (1.0 - dis.probability[i]) / size;
+    }
+    for (unsigned int i = 0; i < size; i++)
+    {
+        EXPECT_NEAR(restored[i], p[i] / sum, 1e-12);
+    }
+
+    dis.deallocate();
+}
+
+TEST_P(discrete_distribution_tests, compact_alias_table)
+{
+    const unsigned int size = GetParam();
+
+    std::vector<double> p = get_probabilities(size, size);
+    double sum = 0.0;
+    for (double v : p)
+    {
+        sum += v;
+    }
+
+    host_compact_distribution dis(p.data(), size, 0);
+    ASSERT_TRUE(dis.probability == NULL);
+    ASSERT_TRUE(dis.alias == NULL);
+    EXPECT_EQ(dis.memory_size(),
+              (sizeof(unsigned long long) + sizeof(double)) * size
+              + sizeof(unsigned int) * (dis.guide_size + 1));
+
+    std::vector<double> restored(size, 0.0);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        const double probability = (dis.compact_alias[i] & 0xFFFFFFFFULL) / 4294967296.0;
+        const unsigned int alias = dis.compact_alias[i] >> 32;
+        ASSERT_LT(alias, size);
+        restored[i] += probability / size;
+        restored[alias] += (1.0 - probability) / size;
+    }
+    for (unsigned int i = 0; i < size; i++)
+    {
+        EXPECT_NEAR(restored[i], p[i] / sum, 1e-9);
+    }
+
+    EXPECT_NEAR(dis.cdf[size - 1], 1.0, 1e-12);
+    double cdf = 0.0;
+    for (unsigned int i = 0; i < size; i++)
+    {
+        cdf += p[i] / sum;
+        EXPECT_NEAR(dis.cdf[i], cdf, 1e-9);
+    }
+
+    // Integer and floating-point lookups differ only near thresholds
+    host_alias_distribution reference(p.data(), size, 0);
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<unsigned int> uniform;
+    const unsigned int samples = 100000;
+    unsigned int mismatches = 0;
+    for (unsigned int i = 0; i < samples; i++)
+    {
+        const unsigned int r = uniform(gen);
+        const unsigned int v = dis(r);
+        ASSERT_LT(v, size);
+        mismatches += v != reference(r) ? 1 : 0;
+    }
+    EXPECT_LE(mismatches, samples / 10000);
+
+    reference.deallocate();
+    dis.deallocate();
+}
+
+TEST_P(discrete_distribution_tests, uniform)
+{
+    const unsigned int size = GetParam();
+
+    std::vector<double> p(size, 0.25);
+    host_compact_distribution dis(p.data(), size, 0);
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        EXPECT_EQ(dis.compact_alias[i], 0xFFFFFFFFULL | (static_cast<unsigned long long>(i) << 32));
+    }
+
+    // The compact table is opt-in, the default keeps the double table
+    host_discrete_distribution universal(p.data(), size, 0);
+    ASSERT_TRUE(universal.compact_alias == NULL);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        EXPECT_EQ(universal.probability[i], 1.0);
+        EXPECT_LT(universal.alias[i], size);
+    }
+
+    universal.deallocate();
+    dis.deallocate();
+}
+
+TEST_P(discrete_distribution_tests, cdf_guide_table)
+{
+    const unsigned int size = GetParam();
+
+    std::vector<double> p = get_probabilities(size, size + 1);
+    host_discrete_distribution dis(p.data(), size, 10);
+
+    ASSERT_GE(dis.guide_size, std::min(size, 1u << 20));
+    // Plain binary search over the whole CDF
+    rocrand_discrete_distribution_st binary_search = dis;
+    binary_search.guide = NULL;
+
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<unsigned int> uniform;
+    for (unsigned int i = 0; i < 10000; i++)
+    {
+        const unsigned int r = uniform(gen);
+        ASSERT_EQ(
+            rocrand_device::detail::discrete_cdf(r, dis),
+            rocrand_device::detail::discrete_cdf(r, binary_search)
+        );
+    }
+    // Bucket boundaries and values of CDF
+    for (unsigned int k = 0; k <= std::min(dis.guide_size, 10000u); k++)
+    {
+        const double x = static_cast<double>(k) / dis.guide_size;
+        ASSERT_EQ(
+            rocrand_device::detail::discrete_cdf(x, dis),
+            rocrand_device::detail::discrete_cdf(x, binary_search)
+        );
+        const double c = dis.cdf[k % size];
+        ASSERT_EQ(
+            rocrand_device::detail::discrete_cdf(c, dis),
+            rocrand_device::detail::discrete_cdf(c, binary_search)
+        );
+    }
+
+    dis.deallocate();
+}
+
+// Small tables are built with Vose's algorithm, large ones in parallel
+const unsigned int sizes[] = { 1, 2, 100, 12345, (1 << 16) + 1, 1000000 };
+
+INSTANTIATE_TEST_CASE_P(discrete_distribution_tests,
+                        discrete_distribution_tests,
+                        ::testing::ValuesIn(sizes));
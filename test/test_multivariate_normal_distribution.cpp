@@ -0,0 +1,167 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <rng/distribution/multivariate_normal.hpp>
+
+typedef multivariate_normal_distribution<> distribution_type;
+typedef multivariate_normal_distribution<normal_distribution<float>, 8> small_distribution_type;
+
+// Packs the lower triangle by rows as it is stored in shared memory
+std::vector<float> pack_factor(const std::vector<float>& factor, unsigned int dimensions)
+{
+    std::vector<float> packed;
+    for(unsigned int row = 0; row < dimensions; row++)
+    {
+        for(unsigned int col = 0; col <= row; col++)
+        {
+            packed.push_back(factor[row * dimensions + col]);
+        }
+    }
+    return packed;
+}
+
+void test_transform(const unsigned int dimensions)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> dis;
+
+    std::vector<float> mean(dimensions);
+    std::vector<float> factor(dimensions * dimensions);
+    for(float& m : mean) m = dis(gen);
+    for(float& f : factor) f = dis(gen);
+
+    distribution_type distribution(dimensions, mean.data(), factor.data());
+
+    // Two vectors stored dimension-blocked
+    const size_t stride = 2;
+    std::vector<float> z(dimensions * stride);
+    for(float& v : z) v = dis(gen);
+    std::vector<float> y = z;
+    distribution.transform(y.data() + 1, stride);
+
+    for(unsigned int r = 0; r < dimensions; r++)
+    {
+        float expected = mean[r];
+        for(unsigned int k = 0; k <= r; k++)
+        {
+            expected += factor[r * dimensions + k] * z[k * stride + 1];
+        }
+        EXPECT_NEAR(y[r * stride + 1], expected, 1e-4f * dimensions);
+        // The other vector is not changed
+        EXPECT_EQ(y[r * stride], z[r * stride]);
+    }
+}
+
+TEST(multivariate_normal_distribution_tests, transform_test)
+{
+    test_transform(1);
+    test_transform(5);
+    test_transform(67);
+}
+
+// Distributions for small factors keep z in registers and read the packed
+// factor, values must be the same as values of the in-place distribution
+template<unsigned int MaxDimensions>
+void test_small(const unsigned int dimensions)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> dis;
+
+    std::vector<float> mean(dimensions);
+    std::vector<float> factor(dimensions * dimensions);
+    for(float& m : mean) m = dis(gen);
+    for(float& f : factor) f = dis(gen);
+    const std::vector<float> packed = pack_factor(factor, dimensions);
+
+    multivariate_normal_distribution<normal_distribution<float>, MaxDimensions>
+        small(dimensions, mean.data(), factor.data());
+    distribution_type any(dimensions, mean.data(), factor.data());
+
+    const unsigned int seed = rd();
+    std::mt19937 gen1(seed), gen2(seed);
+    auto engine1 = [&]() { return static_cast<unsigned int>(gen1()); };
+    auto engine2 = [&]() { return static_cast<unsigned int>(gen2()); };
+
+    // Two vectors stored dimension-blocked
+    const size_t stride = 2;
+    std::vector<float> y1(dimensions * stride, -1.0f);
+    std::vector<float> y2(dimensions * stride, -1.0f);
+    small(engine1, y1.data() + 1, stride, packed.data());
+    any(engine2, y2.data() + 1, stride, NULL);
+    // The same number of values is used
+    EXPECT_EQ(gen1(), gen2());
+
+    for(unsigned int r = 0; r < dimensions; r++)
+    {
+        EXPECT_EQ(y1[r * stride + 1], y2[r * stride + 1]);
+        EXPECT_EQ(y1[r * stride], -1.0f);
+    }
+}
+
+TEST(multivariate_normal_distribution_tests, small_test)
+{
+    test_small<8>(1);
+    test_small<8>(5);
+    test_small<8>(8);
+    test_small<16>(13);
+    test_small<32>(32);
+    test_small<64>(63);
+}
+
+TEST(multivariate_normal_distribution_tests, normals_test)
+{
+    std::mt19937 gen(1234);
+    auto engine = [&]() { return static_cast<unsigned int>(gen()); };
+
+    const unsigned int dimensions = 3;
+    const float factor[dimensions * dimensions] = {
+        1.0f, 0.0f, 0.0f,
+        0.5f, 1.0f, 0.0f,
+        0.0f, 0.0f, 1.0f
+    };
+    const float packed[] = { 1.0f, 0.5f, 1.0f, 0.0f, 0.0f, 1.0f };
+    small_distribution_type distribution(dimensions, NULL, factor);
+
+    const size_t n = 20000;
+    std::vector<float> data(dimensions * n);
+    for(size_t i = 0; i < n; i++)
+    {
+        distribution(engine, data.data() + i, n, packed);
+    }
+
+    // Var(y1) = 0.5^2 + 1, Cov(y0, y1) = 0.5
+    double var1 = 0.0;
+    double cov01 = 0.0;
+    for(size_t i = 0; i < n; i++)
+    {
+        var1 += data[n + i] * data[n + i];
+        cov01 += data[i] * data[n + i];
+    }
+    EXPECT_NEAR(var1 / n, 1.25, 0.05);
+    EXPECT_NEAR(cov01 / n, 0.5, 0.05);
+}
@@ -131,3 +131,53 @@ TEST(normal_distribution_tests, double_test)
     EXPECT_NEAR(1.0f, mean, 0.2); // 20%
     EXPECT_NEAR(2.0f, std, 0.4); // 20%
 }
+
+TEST(normal_distribution_tests, half_test)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<unsigned int> dis;
+
+    const size_t size = 4000;
+    float val[size];
+    normal_distribution<bfloat16_format> u(2.0f, 5.0f);
+
+    // Calculate mean
+    float mean = 0.0f;
+    for(size_t i = 0; i < size; i+=2)
+    {
+        const unsigned int v = u(dis(gen), dis(gen));
+        // bfloat16 is the upper half of float
+        union { unsigned int u; float f; } x, y;
+        x.u = v << 16;
+        y.u = v & 0xFFFF0000;
+        val[i] = x.f;
+        val[i + 1] = y.f;
+        mean += x.f + y.f;
+    }
+    mean = mean / size;
+
+    // Calculate stddev
+    float std = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(val[i] - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    EXPECT_NEAR(2.0f, mean, 0.4f); // 20%
+    EXPECT_NEAR(5.0f, std, 1.0f); // 20%
+
+    // The radius uses a full 32-bit uniform: values up to
+    // sqrt(-2 log(2^-32)) (about 6.66) are possible
+    normal_distribution<half_format> h(0.0f, 1.0f);
+    const unsigned int tail = h(0, 0x40000000);
+    EXPECT_GT(tail & 0xFFFF, 0x4680U); // > 6.5
+    EXPECT_LT((tail >> 16) & 0x7FFF, 0x0400U); // cos(pi / 2)
+    for(size_t i = 0; i < 100; i++)
+    {
+        const unsigned int v = h(dis(gen), dis(gen));
+        EXPECT_LT(v & 0x7FFF, 0x46ACU);
+        EXPECT_LT((v >> 16) & 0x7FFF, 0x46ACU);
+    }
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <rng/distribution/permutation.hpp>
+
+class permutation_distribution_tests : public ::testing::TestWithParam<unsigned long long> { };
+
+TEST_P(permutation_distribution_tests, bijection_test)
+{
+    const unsigned long long n = GetParam();
+
+    std::mt19937 gen(1234);
+    unsigned int keys[ROCRAND_PERMUTATION_ROUNDS];
+    for(unsigned int& key : keys)
+    {
+        key = gen();
+    }
+    const unsigned int half_bits = rocrand_device::detail::permutation_half_bits(n);
+    EXPECT_GE(1ULL << (2 * half_bits), n);
+    EXPECT_LT(1ULL << (2 * half_bits), 4 * n + 4);
+
+    std::vector<bool> found(n, false);
+    for(unsigned long long i = 0; i < n; i++)
+    {
+        const unsigned int v = rocrand_device::detail::permute(i, n, keys, half_bits);
+        ASSERT_LT(v, n);
+        ASSERT_FALSE(found[v]);
+        found[v] = true;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(permutation_distribution_tests,
+                        permutation_distribution_tests,
+                        ::testing::Values(1, 2, 3, 4, 5, 1000, 65537, 1 << 20, 1234567));
+
+TEST(permutation_distribution_tests, uniformity_test)
+{
+    // Every element must appear at the first position with probability 1/n
+    const unsigned int n = 10;
+    const unsigned int trials = 100000;
+    std::mt19937 gen(4321);
+    std::vector<unsigned int> counts(n, 0);
+    for(unsigned int t = 0; t < trials; t++)
+    {
+        unsigned int keys[ROCRAND_PERMUTATION_ROUNDS];
+        for(unsigned int& key : keys)
+        {
+            key = gen();
+        }
+        const unsigned int half_bits = rocrand_device::detail::permutation_half_bits(n);
+        counts[rocrand_device::detail::permute(0, n, keys, half_bits)]++;
+    }
+    for(unsigned int c : counts)
+    {
+        EXPECT_NEAR(static_cast<double>(c) / trials, 1.0 / n, 0.01);
+    }
+}
@@ -125,6 +125,126 @@ TEST_P(poisson_distribution_tests, histogram_compare)
     }
 }
 
+TEST(poisson_distribution_tests, parallel_alias_table)
+{
+    // The table of a large lambda is built in parallel
+    const double lambda = 1e8;
+
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, true> dis;
+    dis.set_lambda(lambda);
+    ASSERT_GE(dis.size, rocrand_host::detail::discrete_parallel_threshold);
+
+    std::vector<double> p(dis.size);
+    double sum = 0.0;
+    for (unsigned int i = 0; i < dis.size; i++)
+    {
+        const double x = static_cast<double>(dis.offset + i);
+        p[i] = std::exp(x * std::log(lambda) - std::lgamma(x + 1.0) - lambda);
+        sum += p[i];
+    }
+
+    // Restore probabilities from the alias table
+    std::vector<double> restored(dis.size, 0.0);
+    for (unsigned int i = 0; i < dis.size; i++)
+    {
+        ASSERT_GE(dis.probability[i], 0.0);
+        ASSERT_LE(dis.probability[i], 1.0);
+        ASSERT_LT(dis.alias[i], dis.size);
+        restored[i] += dis.probability[i] / dis.size;
+        restored[dis.alias[i]] += (1.0 - dis.probability[i]) / dis.size;
+    }
+    double mean = 0.0;
+    for (unsigned int i = 0; i < dis.size; i++)
+    {
+        EXPECT_NEAR(restored[i], p[i] / sum, 1e-12);
+        mean += restored[i] * (dis.offset + i);
+    }
+    EXPECT_NEAR(mean, lambda, 1.0);
+
+    dis.deallocate();
+}
+
+TEST(poisson_distribution_manager_tests, lru_cache)
+{
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+    manager.set_limits(2, 0);
+
+    manager.set_lambda(10.0);
+    manager.set_lambda(20.0);
+    manager.set_lambda(10.0);
+    manager.set_lambda(20.0);
+    EXPECT_EQ(manager.get_misses(), 2);
+    EXPECT_EQ(manager.get_hits(), 2);
+
+    // 30.0 evicts 10.0 (the least recently used)
+    manager.set_lambda(30.0);
+    manager.set_lambda(20.0);
+    EXPECT_EQ(manager.get_misses(), 3);
+    EXPECT_EQ(manager.get_hits(), 3);
+    manager.set_lambda(10.0);
+    EXPECT_EQ(manager.get_misses(), 4);
+
+    // Prewarmed tables do not change the current distribution
+    manager.prewarm(40.0);
+    EXPECT_EQ(manager.get_misses(), 5);
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, true> expected(10.0);
+    EXPECT_EQ(manager.dis.size, expected.size);
+    EXPECT_EQ(manager.dis.offset, expected.offset);
+    expected.deallocate();
+}
+
+TEST(poisson_distribution_manager_tests, prewarm_keeps_current)
+{
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+    manager.set_limits(2, 0);
+
+    manager.set_lambda(10.0);
+    // More tables than the limit, the current one is pinned
+    manager.prewarm(20.0);
+    manager.prewarm(30.0);
+    manager.prewarm(40.0);
+    EXPECT_EQ(manager.get_misses(), 4);
+
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, true> expected(10.0);
+    ASSERT_EQ(manager.dis.size, expected.size);
+    EXPECT_EQ(manager.dis.offset, expected.offset);
+    for(unsigned int i = 0; i < expected.size; i++)
+    {
+        EXPECT_EQ(manager.dis.probability[i], expected.probability[i]);
+        EXPECT_EQ(manager.dis.alias[i], expected.alias[i]);
+    }
+    expected.deallocate();
+
+    // Generation with the previous lambda uses the cached table
+    manager.set_lambda(10.0);
+    EXPECT_EQ(manager.get_misses(), 4);
+    EXPECT_EQ(manager.get_hits(), 1);
+
+    // The pin moves with the current lambda, 10.0 can be evicted now
+    manager.set_lambda(20.0);
+    manager.prewarm(50.0);
+    manager.prewarm(60.0);
+    manager.set_lambda(20.0);
+    EXPECT_EQ(manager.get_misses(), 7);
+    EXPECT_EQ(manager.get_hits(), 2);
+    manager.set_lambda(10.0);
+    EXPECT_EQ(manager.get_misses(), 8);
+}
+
+TEST(poisson_distribution_manager_tests, memory_limit)
+{
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+    // Not enough for any table, only the current one is kept
+    manager.set_limits(8, 1);
+
+    manager.set_lambda(10.0);
+    manager.set_lambda(20.0);
+    manager.set_lambda(20.0);
+    manager.set_lambda(10.0);
+    EXPECT_EQ(manager.get_misses(), 3);
+    EXPECT_EQ(manager.get_hits(), 1);
+}
+
 const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 
 INSTANTIATE_TEST_CASE_P(poisson_distribution_tests,
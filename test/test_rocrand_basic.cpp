@@ -83,6 +83,73 @@ TEST_P(rocrand_basic_tests, rocrand_initialize_generator_test)
     ROCRAND_CHECK(rocrand_destroy_generator(g));
 }
 
+TEST_P(rocrand_basic_tests, rocrand_set_ordering_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEFAULT), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    const bool quasi = rng_type == ROCRAND_RNG_QUASI_SOBOL32;
+    const bool seeded = rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+        || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A;
+    const rocrand_status pseudo_status = quasi ? ROCRAND_STATUS_OUT_OF_RANGE : ROCRAND_STATUS_SUCCESS;
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_BEST), pseudo_status);
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEFAULT), pseudo_status);
+    EXPECT_EQ(
+        rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_SEEDED),
+        seeded ? ROCRAND_STATUS_SUCCESS : ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_set_ordering(g, ROCRAND_ORDERING_QUASI_DEFAULT),
+        quasi ? ROCRAND_STATUS_SUCCESS : ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_memory_pool_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    unsigned int * data;
+    const size_t size = 12345;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Memory of destroyed generators and Poisson tables is reused
+    for(int i = 0; i < 4; i++)
+    {
+        rocrand_generator g = NULL;
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_set_stream(g, stream));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, 10.0 + i));
+        ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, 1000.0 + i));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        if(i == 1)
+        {
+            ROCRAND_CHECK(rocrand_trim_memory());
+        }
+    }
+
+    // Disabled caching
+    ROCRAND_CHECK(rocrand_set_memory_pool_limit(0));
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(g, stream));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, 10.0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_set_memory_pool_limit(256 * 1024 * 1024));
+    ROCRAND_CHECK(rocrand_trim_memory());
+
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
 const rocrand_rng_type rng_types[] = {
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
     ROCRAND_RNG_PSEUDO_MRG32K3A,
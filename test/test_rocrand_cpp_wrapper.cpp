@@ -650,3 +650,100 @@ TEST(rocrand_cpp_wrapper, rocrand_poisson_dist_param)
     d3.param(d1.param());
     ASSERT_TRUE(d1.param() == d3.param());
 }
+
+// Scales words to [0, 1) and clamps them to [0.25, 0.75]
+struct clamped_uniform
+{
+    __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        const float u = v * ROCRAND_2POW32_INV;
+        return u < 0.25f ? 0.25f : (u > 0.75f ? 0.75f : u);
+    }
+
+    __host__ __device__
+    float operator()(const uint4 v) const
+    {
+        return (*this)(v.x ^ v.y ^ v.z ^ v.w);
+    }
+};
+
+template<class T>
+void rocrand_transform_dist_template()
+{
+    T engine;
+    rocrand_cpp::transform_distribution<float, clamped_uniform> d;
+
+    const size_t output_size = 123457;
+    float * output;
+    HIP_CHECK(
+        hipMalloc((void **)&output,
+        output_size * sizeof(float))
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> output_host(output_size);
+    std::vector<float> output_host2(output_size);
+
+    // generate
+    EXPECT_NO_THROW(d(engine, output, output_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    // Next call continues the streams
+    EXPECT_NO_THROW(d(engine, output, output_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output_host2.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_NE(output_host, output_host2);
+
+    // Same seed gives the same values
+    engine.seed(T::default_seed);
+    EXPECT_NO_THROW(d(engine, output, output_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output_host2.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    EXPECT_EQ(output_host, output_host2);
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        ASSERT_GE(v, 0.25f);
+        ASSERT_LE(v, 0.75f);
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.01);
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_transform_dist)
+{
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::philox4x32_10>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::xorwow>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::mrg32k3a>()
+    ));
+}
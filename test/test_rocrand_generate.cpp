@@ -21,6 +21,12 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -73,6 +79,795 @@ TEST(rocrand_generate_tests, simple_test_2)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST(rocrand_generate_tests, half_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+
+    const size_t size = 1234;
+    unsigned short * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned short)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        ROCRAND_CHECK(
+            rocrand_generate_uniform_half(generator, data, size)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        unsigned short host_data[size];
+        HIP_CHECK(hipMemcpy(host_data, data, size * sizeof(unsigned short), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            // (0, 1]: positive and not greater than 1.0 (0x3C00)
+            EXPECT_GT(host_data[i], 0);
+            EXPECT_LE(host_data[i], 0x3C00);
+        }
+
+        ROCRAND_CHECK(
+            rocrand_generate_uniform_bf16(generator, data, size)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data, data, size * sizeof(unsigned short), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            EXPECT_GT(host_data[i], 0);
+            EXPECT_LE(host_data[i], 0x3F80);
+        }
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, bernoulli_bits_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+
+    const size_t words = 4096;
+    const size_t n_bits = words * 32;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, words * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(words);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        const double ps[] = { 0.0, 0.1, 0.5, 0.75, 1.0 };
+        for(double p : ps)
+        {
+            ROCRAND_CHECK(
+                rocrand_generate_bernoulli_bits(generator, data, n_bits, p)
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data, words * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            size_t ones = 0;
+            for(size_t i = 0; i < words; i++)
+            {
+                for(unsigned int word = host_data[i]; word != 0; word &= word - 1)
+                {
+                    ones++;
+                }
+            }
+            EXPECT_NEAR(static_cast<double>(ones) / n_bits, p, 0.01);
+        }
+
+        EXPECT_EQ(
+            rocrand_generate_bernoulli_bits(generator, data, n_bits, 1.5),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, permutation_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32
+    };
+
+    const size_t n = 123457;
+    const size_t k = 1000;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(n);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, data, n));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data(), data, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        std::vector<bool> found(n, false);
+        for(size_t i = 0; i < n; i++)
+        {
+            ASSERT_LT(host_data[i], n);
+            ASSERT_FALSE(found[host_data[i]]);
+            found[host_data[i]] = true;
+        }
+        const std::vector<unsigned int> first(host_data);
+
+        // Next permutation is different
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, data, n));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data(), data, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        EXPECT_NE(first, host_data);
+
+        ROCRAND_CHECK(rocrand_sample_without_replacement(generator, data, k, n));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data(), data, k * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        std::fill(found.begin(), found.end(), false);
+        for(size_t i = 0; i < k; i++)
+        {
+            ASSERT_LT(host_data[i], n);
+            ASSERT_FALSE(found[host_data[i]]);
+            found[host_data[i]] = true;
+        }
+
+        EXPECT_EQ(
+            rocrand_sample_without_replacement(generator, data, n + 1, n),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, data, n),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, latin_hypercube_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32
+    };
+
+    const size_t n = 12345;
+    const unsigned int dimensions = 37;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * dimensions * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n * dimensions);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        ROCRAND_CHECK(rocrand_generate_latin_hypercube(generator, data, n, dimensions));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data(), data, n * dimensions * sizeof(float), hipMemcpyDeviceToHost));
+
+        // Every stratum of every dimension contains exactly one value,
+        // so the i-th smallest value lies in the i-th stratum
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            std::vector<float> values(host_data.begin() + d * n, host_data.begin() + (d + 1) * n);
+            std::sort(values.begin(), values.end());
+            for(size_t i = 0; i < n; i++)
+            {
+                ASSERT_GE(values[i], static_cast<double>(i) / n);
+                ASSERT_LT(values[i], static_cast<double>(i + 1) / n);
+            }
+        }
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_latin_hypercube(generator, data, (1 << 24) + 1, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_latin_hypercube(generator, data, n, dimensions),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, sphere_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32
+    };
+    const unsigned int dimensions[] = { 1, 2, 3, 7 };
+
+    const size_t n = 12345;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * 7 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n * 7);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        for(unsigned int dims : dimensions)
+        {
+            const size_t size = n * dims;
+
+            ROCRAND_CHECK(rocrand_generate_sphere(generator, data, n, dims));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < n; i++)
+            {
+                double norm = 0.0;
+                for(unsigned int d = 0; d < dims; d++)
+                {
+                    norm += host_data[i * dims + d] * host_data[i * dims + d];
+                }
+                ASSERT_NEAR(std::sqrt(norm), 1.0, 1e-4);
+            }
+
+            ROCRAND_CHECK(rocrand_generate_ball(generator, data, n, dims));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < n; i++)
+            {
+                double norm = 0.0;
+                for(unsigned int d = 0; d < dims; d++)
+                {
+                    norm += host_data[i * dims + d] * host_data[i * dims + d];
+                }
+                ASSERT_LE(std::sqrt(norm), 1.0 + 1e-4);
+            }
+
+            ROCRAND_CHECK(rocrand_generate_simplex(generator, data, n, dims));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < n; i++)
+            {
+                double sum = 0.0;
+                for(unsigned int d = 0; d < dims; d++)
+                {
+                    ASSERT_GE(host_data[i * dims + d], 0.0f);
+                    sum += host_data[i * dims + d];
+                }
+                ASSERT_NEAR(sum, 1.0, 1e-4);
+            }
+        }
+
+        EXPECT_EQ(
+            rocrand_generate_sphere(generator, data, n, 0),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_sphere(generator, data, n, 3),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, strided_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+
+    const size_t width = 1234;
+    const size_t height = 56;
+    const size_t stride = 3;
+    const size_t pitch = width * stride + 17;
+    const size_t n = width * height;
+    const size_t size = height * pitch;
+    const unsigned int sentinel = 0xdeadbeef;
+
+    unsigned int * dense;
+    unsigned int * data;
+    float * normal_dense;
+    float * normal_data;
+    HIP_CHECK(hipMalloc((void **)&dense, n * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&normal_dense, n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&normal_data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_dense(n);
+    std::vector<unsigned int> host_data(size);
+    std::vector<float> host_normal_dense(n);
+    std::vector<float> host_normal_data(size);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate(generator, dense, n));
+        ROCRAND_CHECK(rocrand_generate_normal(generator, normal_dense, n, 1.0f, 2.0f));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        // A new generator with the same (default) seed must produce
+        // the same sequence in strided and pitched memory
+        std::fill(host_data.begin(), host_data.end(), sentinel);
+        HIP_CHECK(hipMemcpy(data, host_data.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(normal_data, host_data.data(), size * sizeof(float), hipMemcpyHostToDevice));
+
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate_strided(generator, data, width, height, stride, pitch));
+        ROCRAND_CHECK(
+            rocrand_generate_normal_strided(
+                generator, normal_data, width, height, stride, pitch, 1.0f, 2.0f
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        HIP_CHECK(hipMemcpy(host_dense.data(), dense, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_normal_dense.data(), normal_dense, n * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_normal_data.data(), normal_data, size * sizeof(float), hipMemcpyDeviceToHost));
+        for(size_t r = 0; r < height; r++)
+        {
+            for(size_t i = 0; i < pitch; i++)
+            {
+                const size_t index = r * pitch + i;
+                if(i % stride == 0 && i / stride < width)
+                {
+                    const size_t c = i / stride;
+                    ASSERT_EQ(host_data[index], host_dense[r * width + c]);
+                    ASSERT_EQ(host_normal_data[index], host_normal_dense[r * width + c]);
+                }
+                else
+                {
+                    // Gaps must not be modified
+                    unsigned int normal_bits;
+                    std::memcpy(&normal_bits, &host_normal_data[index], sizeof(float));
+                    ASSERT_EQ(host_data[index], sentinel);
+                    ASSERT_EQ(normal_bits, sentinel);
+                }
+            }
+        }
+
+        EXPECT_EQ(
+            rocrand_generate_strided(generator, data, width, height, 0, pitch),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        EXPECT_EQ(
+            rocrand_generate_strided(generator, data, width, height, stride, width),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(dense));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(normal_dense));
+    HIP_CHECK(hipFree(normal_data));
+}
+
+TEST(rocrand_generate_tests, engine_cache_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW
+    };
+    const unsigned long long seeds[] = { 1, 2, 1, 3, 1, 2, 2 };
+    const unsigned long long offsets[] = { 0, 0, 0, 0, 123, 0, 0 };
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> actual(size);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator cached_generator;
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&cached_generator, rng_type));
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_engine_cache_size(cached_generator, 2));
+
+        // Restored engines must produce the same values as initialized ones
+        for(size_t i = 0; i < sizeof(seeds) / sizeof(seeds[0]); i++)
+        {
+            ROCRAND_CHECK(rocrand_set_seed(generator, seeds[i]));
+            ROCRAND_CHECK(rocrand_set_offset(generator, offsets[i]));
+            ROCRAND_CHECK(rocrand_generate(generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            ROCRAND_CHECK(rocrand_set_seed(cached_generator, seeds[i]));
+            ROCRAND_CHECK(rocrand_set_offset(cached_generator, offsets[i]));
+            ROCRAND_CHECK(rocrand_generate(cached_generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(expected, actual);
+        }
+
+        ROCRAND_CHECK(rocrand_set_engine_cache_size(cached_generator, 0));
+        ROCRAND_CHECK(rocrand_destroy_generator(cached_generator));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_engine_cache_size(generator, 2),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, lazy_init_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW
+    };
+    const size_t sizes[] = { 1, 100, 4567, 1 << 20, 3, 123456 };
+
+    const size_t max_size = 1 << 20;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, max_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> expected(max_size);
+    std::vector<float> actual(max_size);
+    for(auto rng_type : rng_types)
+    {
+        // Engines of generator are initialized for small requests first and
+        // then for larger ones, the values must be the same as when all
+        // engines are initialized at once
+        rocrand_generator generator;
+        rocrand_generator full_generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_create_generator(&full_generator, rng_type));
+        ROCRAND_CHECK(rocrand_initialize_generator(full_generator));
+
+        for(size_t size : sizes)
+        {
+            ROCRAND_CHECK(rocrand_generate_uniform(full_generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+            ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(expected[i], actual[i]);
+            }
+        }
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        ROCRAND_CHECK(rocrand_destroy_generator(full_generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, batched_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MRG32K3A
+    };
+    // Empty, small, not multiple of 4 and larger than one launch
+    const size_t sizes[] = { 0, 1, 3, 1000, 4099, 12345, 1 << 14, (1 << 22) + 7 };
+    const unsigned int count = sizeof(sizes) / sizeof(sizes[0]);
+
+    size_t total_size = 0;
+    for(size_t size : sizes)
+    {
+        total_size += size;
+    }
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, total_size * sizeof(unsigned int)));
+    std::vector<unsigned int *> output_data(count);
+    output_data[0] = data;
+    for(unsigned int i = 1; i < count; i++)
+    {
+        output_data[i] = output_data[i - 1] + sizes[i - 1];
+    }
+
+    std::vector<unsigned int> expected(total_size);
+    std::vector<unsigned int> actual(total_size);
+    for(auto rng_type : rng_types)
+    {
+        // Batched generation must produce the same values as separate calls
+        std::vector<rocrand_generator> generators(count);
+        std::vector<rocrand_generator> reference_generators(count);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            ROCRAND_CHECK(rocrand_create_generator(&generators[i], rng_type));
+            ROCRAND_CHECK(rocrand_create_generator(&reference_generators[i], rng_type));
+            ROCRAND_CHECK(rocrand_set_seed(generators[i], 1234 + i));
+            ROCRAND_CHECK(rocrand_set_seed(reference_generators[i], 1234 + i));
+        }
+
+        // The second call continues from the states left by the first one
+        for(int iteration = 0; iteration < 2; iteration++)
+        {
+            for(unsigned int i = 0; i < count; i++)
+            {
+                ROCRAND_CHECK(rocrand_generate(reference_generators[i], output_data[i], sizes[i]));
+            }
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(expected.data(), data, total_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            ROCRAND_CHECK(rocrand_generate_batched(generators.data(), output_data.data(), sizes, count));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(actual.data(), data, total_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < total_size; i++)
+            {
+                ASSERT_EQ(expected[i], actual[i]);
+            }
+        }
+
+        // The same generator used twice is processed sequentially
+        rocrand_generator same_generators[] = { generators[3], generators[3] };
+        ROCRAND_CHECK(rocrand_generate(reference_generators[3], output_data[0], sizes[3]));
+        ROCRAND_CHECK(rocrand_generate(reference_generators[3], output_data[0] + sizes[3], sizes[3]));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(expected.data(), data, 2 * sizes[3] * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        unsigned int * same_output_data[] = { output_data[0], output_data[0] + sizes[3] };
+        const size_t same_sizes[] = { sizes[3], sizes[3] };
+        ROCRAND_CHECK(rocrand_generate_batched(same_generators, same_output_data, same_sizes, 2));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(actual.data(), data, 2 * sizes[3] * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < 2 * sizes[3]; i++)
+        {
+            ASSERT_EQ(expected[i], actual[i]);
+        }
+
+        for(unsigned int i = 0; i < count; i++)
+        {
+            ROCRAND_CHECK(rocrand_destroy_generator(generators[i]));
+            ROCRAND_CHECK(rocrand_destroy_generator(reference_generators[i]));
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, batched_neg_test)
+{
+    EXPECT_EQ(rocrand_generate_batched(NULL, NULL, NULL, 0), ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(rocrand_generate_batched(NULL, NULL, NULL, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    rocrand_generator generators[] = { NULL };
+    unsigned int * output_data[] = { NULL };
+    const size_t sizes[] = { 256 };
+    EXPECT_EQ(
+        rocrand_generate_batched(generators, output_data, sizes, 1),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_tests, tuning_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+    const size_t size = 1 << 20;
+    // Enough launches to measure all candidates
+    const int iterations = 20;
+    const char * cache_path = "rocrand_tuning_test.cache";
+    std::remove(cache_path);
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, iterations * size * sizeof(float)));
+
+    std::vector<float> expected(iterations * size);
+    std::vector<float> actual(iterations * size);
+    for(auto rng_type : rng_types)
+    {
+        // Values do not depend on launch geometry
+        const rocrand_tuning_mode modes[] = {
+            ROCRAND_TUNING_DEFAULT,
+            ROCRAND_TUNING_AUTOTUNE,
+            ROCRAND_TUNING_CACHED
+        };
+        for(auto mode : modes)
+        {
+            ROCRAND_CHECK(rocrand_set_tuning_mode(mode));
+            ROCRAND_CHECK(rocrand_set_tuning_cache(mode == ROCRAND_TUNING_DEFAULT ? NULL : cache_path));
+
+            rocrand_generator generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+            for(int i = 0; i < iterations; i++)
+            {
+                ROCRAND_CHECK(rocrand_generate_uniform(generator, data + i * size, size));
+                // Measurements are collected when they are completed
+                HIP_CHECK(hipDeviceSynchronize());
+            }
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+            std::vector<float>& result = mode == ROCRAND_TUNING_DEFAULT ? expected : actual;
+            HIP_CHECK(hipMemcpy(result.data(), data, iterations * size * sizeof(float), hipMemcpyDeviceToHost));
+            if(mode != ROCRAND_TUNING_DEFAULT)
+            {
+                for(size_t i = 0; i < iterations * size; i++)
+                {
+                    ASSERT_EQ(expected[i], actual[i]);
+                }
+            }
+        }
+    }
+
+    // Tuned block sizes are stored in the cache, keys use stable names
+    // of output types and distributions
+    FILE * cache = std::fopen(cache_path, "r");
+    ASSERT_NE(cache, (FILE *)NULL);
+    std::vector<char> contents(1 << 16);
+    const size_t length = std::fread(contents.data(), 1, contents.size() - 1, cache);
+    std::fclose(cache);
+    contents[length] = '\0';
+    EXPECT_NE(std::strstr(contents.data(), "\tgenerate\tf32\tuniform_f32\t"), (char *)NULL);
+
+    ROCRAND_CHECK(rocrand_set_tuning_mode(ROCRAND_TUNING_CACHED));
+    ROCRAND_CHECK(rocrand_set_tuning_cache(NULL));
+    std::remove(cache_path);
+    EXPECT_EQ(
+        rocrand_set_tuning_mode(static_cast<rocrand_tuning_mode>(3)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, ordering_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW
+    };
+    const size_t size = (1 << 20) + 3;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> actual(size);
+    for(auto rng_type : rng_types)
+    {
+        const bool seeded = rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        std::vector<rocrand_ordering> orders;
+        orders.push_back(ROCRAND_ORDERING_PSEUDO_DEFAULT);
+        orders.push_back(ROCRAND_ORDERING_PSEUDO_BEST);
+        if(seeded)
+        {
+            orders.push_back(ROCRAND_ORDERING_PSEUDO_SEEDED);
+        }
+
+        for(auto order : orders)
+        {
+            // Values of an ordering are the same for the same seed,
+            // switching orderings does not affect them
+            rocrand_generator generator;
+            rocrand_generator reference_generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+            ROCRAND_CHECK(rocrand_create_generator(&reference_generator, rng_type));
+            ROCRAND_CHECK(rocrand_set_seed(generator, 5678));
+            ROCRAND_CHECK(rocrand_set_seed(reference_generator, 5678));
+            ROCRAND_CHECK(rocrand_set_ordering(reference_generator, order));
+            ROCRAND_CHECK(rocrand_set_ordering(generator, seeded ? ROCRAND_ORDERING_PSEUDO_SEEDED : ROCRAND_ORDERING_PSEUDO_BEST));
+            ROCRAND_CHECK(rocrand_generate(generator, data, size));
+            ROCRAND_CHECK(rocrand_set_ordering(generator, order));
+
+            for(int i = 0; i < 2; i++)
+            {
+                ROCRAND_CHECK(rocrand_generate(reference_generator, data, size));
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+                ROCRAND_CHECK(rocrand_generate(generator, data, size));
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+                for(size_t j = 0; j < size; j++)
+                {
+                    ASSERT_EQ(expected[j], actual[j]);
+                }
+            }
+
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+            ROCRAND_CHECK(rocrand_destroy_generator(reference_generator));
+        }
+
+        if(seeded)
+        {
+            // Seeded engines produce other values than the default ordering
+            rocrand_generator generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+            ROCRAND_CHECK(rocrand_generate(generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED));
+            ROCRAND_CHECK(rocrand_generate(generator, data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            size_t same = 0;
+            for(size_t j = 0; j < size; j++)
+            {
+                same += expected[j] == actual[j] ? 1 : 0;
+            }
+            EXPECT_LT(same, size / 1000);
+
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_generate_tests, simple_neg_test)
 {
     const size_t size = 256;
@@ -21,6 +21,9 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -101,6 +104,283 @@ TEST(rocrand_generate_normal_tests, double_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST(rocrand_generate_normal_tests, half_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    float mean = 5.0f;
+    float stddev = 2.0f;
+    unsigned short * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned short)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // n must be even
+    EXPECT_EQ(
+        rocrand_generate_normal_half(generator, data, 1, mean, stddev),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    // pointer must be aligned
+    EXPECT_EQ(
+        rocrand_generate_normal_bf16(generator, data + 1, 2, mean, stddev),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_half(generator, data, size, mean, stddev)
+    );
+    ROCRAND_CHECK(
+        rocrand_generate_normal_bf16(generator, data, size, mean, stddev)
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_normal_tests, multivariate_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+
+    // Covariance matrix is {{4, 2, 0}, {2, 2, 1}, {0, 1, 5}}
+    const unsigned int dimensions = 3;
+    const float host_mean[dimensions] = { 1.0f, -1.0f, 10.0f };
+    const float host_factor[dimensions * dimensions] = {
+        2.0f, 0.0f, 0.0f,
+        1.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 2.0f
+    };
+    const double covariance[dimensions][dimensions] = {
+        { 4.0, 2.0, 0.0 },
+        { 2.0, 2.0, 1.0 },
+        { 0.0, 1.0, 5.0 }
+    };
+
+    const size_t n_vectors = 100000;
+    float * data;
+    float * mean;
+    float * factor;
+    HIP_CHECK(hipMalloc((void **)&data, n_vectors * dimensions * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&mean, dimensions * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&factor, dimensions * dimensions * sizeof(float)));
+    HIP_CHECK(hipMemcpy(mean, host_mean, dimensions * sizeof(float), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(factor, host_factor, dimensions * dimensions * sizeof(float), hipMemcpyHostToDevice));
+
+    std::vector<float> host_data(n_vectors * dimensions);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, dimensions));
+        }
+
+        ROCRAND_CHECK(
+            rocrand_generate_multivariate_normal(generator, data, n_vectors,
+                                                 dimensions, mean, factor)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * dimensions * sizeof(float), hipMemcpyDeviceToHost));
+
+        // Values are dimension-blocked
+        double sample_mean[dimensions] = { };
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            for(size_t i = 0; i < n_vectors; i++)
+            {
+                sample_mean[d] += host_data[d * n_vectors + i];
+            }
+            sample_mean[d] /= n_vectors;
+            EXPECT_NEAR(sample_mean[d], host_mean[d], 0.05);
+        }
+        for(unsigned int a = 0; a < dimensions; a++)
+        {
+            for(unsigned int b = 0; b < dimensions; b++)
+            {
+                double c = 0.0;
+                for(size_t i = 0; i < n_vectors; i++)
+                {
+                    c += (host_data[a * n_vectors + i] - sample_mean[a])
+                        * (host_data[b * n_vectors + i] - sample_mean[b]);
+                }
+                c /= n_vectors;
+                EXPECT_NEAR(c, covariance[a][b], 0.1);
+            }
+        }
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(mean));
+    HIP_CHECK(hipFree(factor));
+}
+
+TEST(rocrand_generate_normal_tests, truncated_test)
+{
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+    // Central, tail and narrow tail intervals
+    const double bounds[][2] = { { -1.0, 0.5 }, { 3.0, 10.0 }, { -4.1, -4.0 } };
+
+    const size_t size = 12345;
+    float * data;
+    double * data_double;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data_double, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    std::vector<double> host_data_double(size);
+    for(auto rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        for(auto b : bounds)
+        {
+            ROCRAND_CHECK(
+                rocrand_generate_truncated_normal(generator, data, size,
+                                                  0.0f, 1.0f, b[0], b[1])
+            );
+            ROCRAND_CHECK(
+                rocrand_generate_truncated_normal_double(generator, data_double, size,
+                                                         0.0, 1.0, b[0], b[1])
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(host_data_double.data(), data_double, size * sizeof(double), hipMemcpyDeviceToHost));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_GE(host_data[i], static_cast<float>(b[0]));
+                ASSERT_LE(host_data[i], static_cast<float>(b[1]));
+                ASSERT_GE(host_data_double[i], b[0]);
+                ASSERT_LE(host_data_double[i], b[1]);
+            }
+        }
+
+        EXPECT_EQ(
+            rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 2.0f, 1.0f),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        EXPECT_EQ(
+            rocrand_generate_truncated_normal(generator, data, size, 0.0f, 0.0f, 1.0f, 2.0f),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_double));
+}
+
+TEST(rocrand_generate_normal_tests, brownian_paths_test)
+{
+    const unsigned int steps = 8;
+    const float times[steps] = { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f };
+    const size_t n_paths = 1 << 14;
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n_paths * steps * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, steps));
+
+    std::vector<float> host_data(n_paths * steps);
+    ROCRAND_CHECK(
+        rocrand_generate_brownian_paths(generator, data, n_paths, steps, times, NULL)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_paths * steps * sizeof(float), hipMemcpyDeviceToHost));
+
+    // Values are path-major, cov(W(s), W(t)) = min(s, t)
+    for(unsigned int a = 0; a < steps; a++)
+    {
+        double m = 0.0;
+        for(size_t i = 0; i < n_paths; i++)
+        {
+            m += host_data[i * steps + a];
+        }
+        EXPECT_NEAR(m / n_paths, 0.0, 0.01);
+        for(unsigned int b = 0; b < steps; b++)
+        {
+            double c = 0.0;
+            for(size_t i = 0; i < n_paths; i++)
+            {
+                c += host_data[i * steps + a] * host_data[i * steps + b];
+            }
+            EXPECT_NEAR(c / n_paths, std::min(times[a], times[b]), 0.05);
+        }
+    }
+
+    // Long paths are staged in the output instead of shared memory
+    const unsigned int long_steps = 300;
+    const size_t long_paths = 4096;
+    float * long_data;
+    HIP_CHECK(hipMalloc((void **)&long_data, long_paths * long_steps * sizeof(float)));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, long_steps));
+    ROCRAND_CHECK(
+        rocrand_generate_brownian_paths(generator, long_data, long_paths, long_steps, NULL, NULL)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<float> long_host_data(long_paths * long_steps);
+    HIP_CHECK(hipMemcpy(long_host_data.data(), long_data, long_paths * long_steps * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(long_data));
+    // Var(W(t)) = t for times 1, 2, ..., steps
+    for(unsigned int a = 0; a < long_steps; a += 37)
+    {
+        double v = 0.0;
+        for(size_t i = 0; i < long_paths; i++)
+        {
+            v += long_host_data[i * long_steps + a] * long_host_data[i * long_steps + a];
+        }
+        EXPECT_NEAR(v / long_paths / (a + 1), 1.0, 0.1);
+    }
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, steps));
+
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, n_paths, steps - 1, NULL, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    const unsigned int ordering[steps] = { 7, 3, 1, 5, 0, 2, 4, 4 };
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, n_paths, steps, NULL, ordering),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, n_paths, steps, NULL, NULL),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_generate_normal_tests, neg_test)
 {
     const size_t size = 256;
@@ -21,6 +21,9 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -88,3 +91,232 @@ TEST(rocrand_generate_poisson_tests, out_of_range_test)
     HIP_CHECK(hipFree(data));
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
+
+TEST(rocrand_generate_poisson_tests, cache_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const double prewarm_lambdas[] = { 10.0, 100.0 };
+    ROCRAND_CHECK(rocrand_set_poisson_cache_limits(generator, 4, 0));
+    ROCRAND_CHECK(rocrand_prewarm_poisson_cache(generator, prewarm_lambdas, 2));
+
+    for(int i = 0; i < 4; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 100.0));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long hits;
+    unsigned long long misses;
+    ROCRAND_CHECK(rocrand_get_poisson_cache_stats(generator, &hits, &misses));
+    EXPECT_EQ(misses, 2);
+    EXPECT_EQ(hits, 8);
+
+    EXPECT_EQ(
+        rocrand_set_poisson_cache_limits(generator, 0, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    const double wrong_lambda = -1.0;
+    EXPECT_EQ(
+        rocrand_prewarm_poisson_cache(generator, &wrong_lambda, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_poisson_tests, prewarm_past_limit_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_set_poisson_cache_limits(generator, 2, 0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+
+    // More tables than the limit, the table of 10.0 is still current
+    const double prewarm_lambdas[] = { 20.0, 30.0, 40.0 };
+    ROCRAND_CHECK(rocrand_prewarm_poisson_cache(generator, prewarm_lambdas, 3));
+
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long hits;
+    unsigned long long misses;
+    ROCRAND_CHECK(rocrand_get_poisson_cache_stats(generator, &hits, &misses));
+    EXPECT_EQ(misses, 4);
+    EXPECT_EQ(hits, 1);
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 10.0, 1.0);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_poisson_tests, async_lambda_change_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+    // Only one table is cached, so tables are evicted and their memory
+    // is reused while previous kernels may be still running
+    ROCRAND_CHECK(rocrand_set_poisson_cache_limits(generator, 1, 0));
+
+    const size_t size = 1 << 18;
+    const double lambdas[] = { 5.0, 2000.0, 50.0, 1000.0, 5.0, 20000.0 };
+    const size_t count = sizeof(lambdas) / sizeof(lambdas[0]);
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, count * size * sizeof(unsigned int)));
+
+    for(size_t i = 0; i < count; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data + i * size, size, lambdas[i]));
+    }
+
+    std::vector<unsigned int> host_data(count * size);
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(
+        hipMemcpy(
+            host_data.data(), data,
+            count * size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    for(size_t i = 0; i < count; i++)
+    {
+        double mean = 0.0;
+        for(size_t j = 0; j < size; j++)
+        {
+            mean += host_data[i * size + j];
+        }
+        mean /= size;
+        EXPECT_NEAR(mean, lambdas[i], std::max(1.0, lambdas[i] * 1e-2));
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+class rocrand_generate_poisson_array_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_poisson_array_tests, mean_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Even elements use small lambda, odd elements use large lambda
+    const size_t size = 1 << 20;
+    const double lambda0 = 3.5;
+    const double lambda1 = 500.0;
+    std::vector<double> host_lambdas(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        host_lambdas[i] = (i % 2 == 0) ? lambda0 : lambda1;
+    }
+
+    double * lambdas;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&lambdas, size * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(
+            lambdas, host_lambdas.data(), size * sizeof(double),
+            hipMemcpyHostToDevice
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_poisson_array(generator, data, lambdas, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(
+        hipMemcpy(
+            host_data.data(), data, size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    double mean0 = 0.0;
+    double mean1 = 0.0;
+    for(size_t i = 0; i < size; i += 2)
+    {
+        mean0 += host_data[i];
+        mean1 += host_data[i + 1];
+    }
+    mean0 /= size / 2;
+    mean1 /= size / 2;
+
+    EXPECT_NEAR(mean0, lambda0, lambda0 * 1e-2);
+    EXPECT_NEAR(mean1, lambda1, lambda1 * 1e-2);
+
+    HIP_CHECK(hipFree(lambdas));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_poisson_array_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+    double * lambdas = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_poisson_array(generator, data, lambdas, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_poisson_array_tests,
+                        rocrand_generate_poisson_array_tests,
+                        ::testing::ValuesIn(rng_types));
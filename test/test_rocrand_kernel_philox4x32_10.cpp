@@ -117,6 +117,47 @@ void rocrand_normal_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_truncated_normal_kernel(float * output, const size_t size,
+                                     const float lower, const float upper)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_truncated_normal(&state, 1.0f, 2.0f, lower, upper);
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_permute_kernel(unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    // All threads use the same permutation
+    GeneratorState state;
+    rocrand_init(0, 0, 0, &state);
+    rocrand_permutation permutation;
+    rocrand_init_permutation(size, &state, &permutation);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_permute(&permutation, index);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_log_normal_kernel(float * output, const size_t size)
@@ -421,23 +462,70 @@ TEST(rocrand_kernel_philox4x32_10, rocrand_log_normal)
     EXPECT_NEAR(0.25, logstd, 0.25 * 0.2);
 }
 
-class rocrand_kernel_philox4x32_10_poisson : public ::testing::TestWithParam<double> { };
-
-TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson)
+TEST(rocrand_kernel_philox4x32_10, rocrand_truncated_normal)
 {
     typedef rocrand_state_philox4x32_10 state_type;
 
-    const double lambda = GetParam();
+    // Central and tail intervals of the normal distribution with mean 1 and stddev 2
+    const float bounds[][2] = { { -1.0f, 2.0f }, { 5.0f, 6.0f }, { 9.0f, 30.0f }, { -20.0f, -5.0f } };
+    for(auto b : bounds)
+    {
+        const size_t output_size = 8192;
+        float * output;
+        HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_truncated_normal_kernel<state_type>),
+            dim3(8), dim3(32), 0, 0,
+            output, output_size, b[0], b[1]
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<float> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(output));
 
-    const size_t output_size = 8192;
+        double mean = 0;
+        for(auto v : output_host)
+        {
+            EXPECT_GE(v, b[0]);
+            EXPECT_LE(v, b[1]);
+            mean += static_cast<double>(v);
+        }
+        mean = mean / output_size;
+
+        // Mean of the truncated distribution
+        const double alpha = (b[0] - 1.0) / 2.0;
+        const double beta = (b[1] - 1.0) / 2.0;
+        const double pdf_alpha = std::exp(-alpha * alpha / 2.0);
+        const double pdf_beta = std::exp(-beta * beta / 2.0);
+        const double z = std::sqrt(2.0 * M_PI) * 0.5 * (std::erfc(-beta / std::sqrt(2.0)) - std::erfc(-alpha / std::sqrt(2.0)));
+        const double expected_mean = 1.0 + 2.0 * (pdf_alpha - pdf_beta) / z;
+        EXPECT_NEAR(mean, expected_mean, 0.05 * (b[1] - b[0]));
+    }
+}
+
+TEST(rocrand_kernel_philox4x32_10, rocrand_permute)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const size_t output_size = 10007;
     unsigned int * output;
     HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
     HIP_CHECK(hipDeviceSynchronize());
 
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(rocrand_poisson_kernel<state_type>),
-        dim3(4), dim3(64), 0, 0,
-        output, output_size, lambda
+        HIP_KERNEL_NAME(rocrand_permute_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, output_size
     );
     HIP_CHECK(hipPeekAtLastError());
 
@@ -452,25 +540,18 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson)
     HIP_CHECK(hipDeviceSynchronize());
     HIP_CHECK(hipFree(output));
 
-    double mean = 0;
+    std::vector<bool> found(output_size, false);
     for(auto v : output_host)
     {
-        mean += static_cast<double>(v);
+        ASSERT_LT(v, output_size);
+        ASSERT_FALSE(found[v]);
+        found[v] = true;
     }
-    mean = mean / output_size;
-
-    double variance = 0;
-    for(auto v : output_host)
-    {
-        variance += std::pow(v - mean, 2);
-    }
-    variance = variance / output_size;
-
-    EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
-    EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
-TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
+class rocrand_kernel_philox4x32_10_poisson : public ::testing::TestWithParam<double> { };
+
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson)
 {
     typedef rocrand_state_philox4x32_10 state_type;
 
@@ -481,13 +562,10 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
     HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
     HIP_CHECK(hipDeviceSynchronize());
 
-    rocrand_discrete_distribution discrete_distribution;
-    ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
-
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+        HIP_KERNEL_NAME(rocrand_poisson_kernel<state_type>),
         dim3(4), dim3(64), 0, 0,
-        output, output_size, discrete_distribution
+        output, output_size, lambda
     );
     HIP_CHECK(hipPeekAtLastError());
 
@@ -501,7 +579,6 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
     );
     HIP_CHECK(hipDeviceSynchronize());
     HIP_CHECK(hipFree(output));
-    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
 
     double mean = 0;
     for(auto v : output_host)
@@ -521,6 +598,68 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
     EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const double lambda = GetParam();
+
+    // Default and compact tables
+    for(int compact = 0; compact < 2; compact++)
+    {
+        const size_t output_size = 8192;
+        unsigned int * output;
+        HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        rocrand_discrete_distribution discrete_distribution;
+        if(compact)
+        {
+            ROCRAND_CHECK(rocrand_create_poisson_distribution_compact(lambda, &discrete_distribution));
+        }
+        else
+        {
+            ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+            dim3(4), dim3(64), 0, 0,
+            output, output_size, discrete_distribution
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(output));
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+        double mean = 0;
+        for(auto v : output_host)
+        {
+            mean += static_cast<double>(v);
+        }
+        mean = mean / output_size;
+
+        double variance = 0;
+        for(auto v : output_host)
+        {
+            variance += std::pow(v - mean, 2);
+        }
+        variance = variance / output_size;
+
+        EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
+        EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
+    }
+}
+
 const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 
 INSTANTIATE_TEST_CASE_P(rocrand_kernel_philox4x32_10_poisson,
@@ -112,6 +112,26 @@ void rocrand_normal_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_truncated_normal_kernel(float * output, const size_t size,
+                                     const float lower, const float upper)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 456ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_truncated_normal(&state, 1.0f, 2.0f, lower, upper);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_log_normal_kernel(float * output, const size_t size)
@@ -406,6 +426,57 @@ TEST(rocrand_kernel_xorwow, rocrand_log_normal)
     EXPECT_NEAR(0.25, logstd, 0.25 * 0.2);
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_truncated_normal)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    // Central and tail intervals of the normal distribution with mean 1 and stddev 2
+    const float bounds[][2] = { { -1.0f, 2.0f }, { 5.0f, 6.0f }, { 9.0f, 30.0f }, { -20.0f, -5.0f } };
+    for(auto b : bounds)
+    {
+        const size_t output_size = 8192;
+        float * output;
+        HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_truncated_normal_kernel<state_type>),
+            dim3(8), dim3(32), 0, 0,
+            output, output_size, b[0], b[1]
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<float> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(output));
+
+        double mean = 0;
+        for(auto v : output_host)
+        {
+            EXPECT_GE(v, b[0]);
+            EXPECT_LE(v, b[1]);
+            mean += static_cast<double>(v);
+        }
+        mean = mean / output_size;
+
+        // Mean of the truncated distribution
+        const double alpha = (b[0] - 1.0) / 2.0;
+        const double beta = (b[1] - 1.0) / 2.0;
+        const double pdf_alpha = std::exp(-alpha * alpha / 2.0);
+        const double pdf_beta = std::exp(-beta * beta / 2.0);
+        const double z = std::sqrt(2.0 * M_PI) * 0.5 * (std::erfc(-beta / std::sqrt(2.0)) - std::erfc(-alpha / std::sqrt(2.0)));
+        const double expected_mean = 1.0 + 2.0 * (pdf_alpha - pdf_beta) / z;
+        EXPECT_NEAR(mean, expected_mean, 0.05 * (b[1] - b[0]));
+    }
+}
+
 class rocrand_kernel_xorwow_poisson : public ::testing::TestWithParam<double> { };
 
 TEST_P(rocrand_kernel_xorwow_poisson, rocrand_poisson)
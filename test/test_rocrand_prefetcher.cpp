@@ -0,0 +1,163 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_prefetcher_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_prefetcher_tests, same_values_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t block_size = 12345 * 4;
+    const unsigned int blocks = 3;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    rocrand_generator reference_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&reference_generator, rng_type));
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * block_size));
+    std::vector<unsigned int> expected(block_size);
+
+    rocrand_prefetcher prefetcher;
+    ROCRAND_CHECK(rocrand_create_prefetcher(&prefetcher, generator, block_size, blocks));
+
+    // More blocks than buffers, the values are the same as the values
+    // of consecutive rocrand_generate calls
+    for(unsigned int i = 0; i < 4 * blocks; i++)
+    {
+        const unsigned int * block;
+        size_t n;
+        ROCRAND_CHECK(rocrand_next_block(prefetcher, &block, &n));
+        ASSERT_EQ(n, block_size);
+
+        ROCRAND_CHECK(rocrand_generate(reference_generator, data, block_size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, sizeof(unsigned int) * block_size, hipMemcpyDeviceToHost));
+        for(size_t j = 0; j < block_size; j++)
+        {
+            ASSERT_EQ(block[j], expected[j]);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_prefetcher(prefetcher));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipStreamDestroy(stream));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference_generator));
+}
+
+TEST(rocrand_prefetcher_tests, failed_fill_test)
+{
+    // Block size is not a multiple of 3, so generation fails while
+    // the generator has 3 dimensions
+    const size_t block_size = 4000;
+    const unsigned int blocks = 2;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    rocrand_generator reference_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&reference_generator, ROCRAND_RNG_QUASI_SOBOL32));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * block_size));
+    std::vector<unsigned int> expected(block_size);
+
+    rocrand_prefetcher prefetcher;
+    ROCRAND_CHECK(rocrand_create_prefetcher(&prefetcher, generator, block_size, blocks));
+
+    const unsigned int * block;
+    size_t n;
+    for(unsigned int i = 0; i < 4 * blocks; i++)
+    {
+        if(i == 1)
+        {
+            // Refilling of the first block fails, the following block must
+            // not be returned until the refill succeeds
+            ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 3));
+            EXPECT_EQ(rocrand_next_block(prefetcher, &block, &n), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+            EXPECT_EQ(rocrand_next_block(prefetcher, &block, &n), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+            // Continue from the values after the prefetched blocks
+            ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 1));
+            ROCRAND_CHECK(rocrand_set_offset(generator, blocks * block_size));
+        }
+        ROCRAND_CHECK(rocrand_next_block(prefetcher, &block, &n));
+        ASSERT_EQ(n, block_size);
+
+        ROCRAND_CHECK(rocrand_generate(reference_generator, data, block_size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, sizeof(unsigned int) * block_size, hipMemcpyDeviceToHost));
+        for(size_t j = 0; j < block_size; j++)
+        {
+            ASSERT_EQ(block[j], expected[j]);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_prefetcher(prefetcher));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference_generator));
+}
+
+TEST(rocrand_prefetcher_tests, neg_test)
+{
+    rocrand_prefetcher prefetcher = NULL;
+    const unsigned int * block;
+    size_t n;
+    EXPECT_EQ(rocrand_create_prefetcher(&prefetcher, NULL, 1024, 2), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_next_block(prefetcher, &block, &n), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_destroy_prefetcher(prefetcher), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_create_prefetcher(NULL, generator, 1024, 2), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_create_prefetcher(&prefetcher, generator, 0, 2), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_create_prefetcher(&prefetcher, generator, 1024, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_create_prefetcher(&prefetcher, generator, 1024, 2));
+    EXPECT_EQ(rocrand_next_block(prefetcher, NULL, &n), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_next_block(prefetcher, &block, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_prefetcher(prefetcher));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_prefetcher_tests,
+                        rocrand_prefetcher_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -290,3 +290,34 @@ TEST(rocrand_xorwow_prng_tests, discard_sequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+// Jump-ahead must produce the same states as the matrix-based
+// implementation (reference values were generated with it)
+TEST(rocrand_xorwow_prng_tests, discard_reference_test)
+{
+    rocrand_xorwow::engine_type engine1(0xdeadbeef12345678ULL, 262143ULL, 0xfedcba9876543210ULL);
+    rocrand_xorwow::engine_type engine2(12345ULL, 0xffffffffffffffffULL, 0ULL);
+
+    const unsigned int expected1[] = { 1381595355U, 984643692U, 1049095064U, 533929062U };
+    const unsigned int expected2[] = { 3866165395U, 1930265880U, 744496219U, 1697416007U };
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(engine1(), expected1[i]);
+        EXPECT_EQ(engine2(), expected2[i]);
+    }
+}
+
+TEST(rocrand_xorwow_prng_tests, discard_subsequence_offset_test)
+{
+    const unsigned long long seed = 1234567890123ULL;
+    rocrand_xorwow::engine_type engine1(seed, 1ULL, 0ULL);
+    rocrand_xorwow::engine_type engine2(seed, 0ULL, 0ULL);
+
+    // 2^67 = 16 * 2^63
+    for (int i = 0; i < 16; i++)
+    {
+        engine2.discard(1ULL << 63);
+    }
+
+    EXPECT_EQ(engine1(), engine2());
+}
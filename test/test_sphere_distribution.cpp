@@ -0,0 +1,121 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <rng/distribution/sphere.hpp>
+
+struct counting_engine
+{
+    std::mt19937 gen;
+    unsigned int calls;
+
+    counting_engine() : gen(1234), calls(0) {}
+
+    unsigned int operator()()
+    {
+        calls++;
+        return gen();
+    }
+};
+
+class sphere_distribution_tests : public ::testing::TestWithParam<unsigned int> { };
+
+void check_points(sphere_shape shape, unsigned int dimensions)
+{
+    sphere_distribution<> distribution(shape, dimensions);
+    counting_engine engine;
+
+    const size_t size = 20000;
+    std::vector<float> point(dimensions);
+    std::vector<double> mean(dimensions, 0.0);
+    double norms = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const unsigned int calls = engine.calls;
+        distribution(engine, point.data());
+        ASSERT_EQ(engine.calls - calls, distribution.values());
+
+        double sum = 0.0;
+        double norm = 0.0;
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            sum += point[d];
+            norm += point[d] * point[d];
+            mean[d] += point[d];
+        }
+        norm = std::sqrt(norm);
+        norms += norm;
+        if(shape == SPHERE_SHAPE_SPHERE)
+        {
+            ASSERT_NEAR(norm, 1.0, 1e-4);
+        }
+        else if(shape == SPHERE_SHAPE_BALL)
+        {
+            ASSERT_LE(norm, 1.0 + 1e-4);
+        }
+        else
+        {
+            ASSERT_NEAR(sum, 1.0, 1e-4);
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                ASSERT_GE(point[d], 0.0f);
+            }
+        }
+    }
+
+    // Spheres and balls are symmetric, all vertices of the simplex
+    // are equally likely
+    const double expected_mean = shape == SPHERE_SHAPE_SIMPLEX ? 1.0 / dimensions : 0.0;
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        EXPECT_NEAR(mean[d] / size, expected_mean, 0.03);
+    }
+    if(shape == SPHERE_SHAPE_BALL)
+    {
+        // E[r] = dimensions / (dimensions + 1)
+        EXPECT_NEAR(norms / size, dimensions / (dimensions + 1.0), 0.01);
+    }
+}
+
+TEST_P(sphere_distribution_tests, sphere_test)
+{
+    check_points(SPHERE_SHAPE_SPHERE, GetParam());
+}
+
+TEST_P(sphere_distribution_tests, ball_test)
+{
+    check_points(SPHERE_SHAPE_BALL, GetParam());
+}
+
+TEST_P(sphere_distribution_tests, simplex_test)
+{
+    check_points(SPHERE_SHAPE_SIMPLEX, GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(sphere_distribution_tests,
+                        sphere_distribution_tests,
+                        ::testing::Values(1, 2, 3, 4, 5, 16));
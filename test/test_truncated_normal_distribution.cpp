@@ -0,0 +1,82 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <rng/distribution/truncated_normal.hpp>
+
+template<class T>
+void test_method()
+{
+    using namespace rocrand_device::detail;
+
+    EXPECT_EQ(truncated_normal_params<T>(0, 1, -1, 1).method, TRUNCATED_NORMAL_INVERSE_CDF);
+    EXPECT_EQ(truncated_normal_params<T>(0, 1, 0.5, 10).method, TRUNCATED_NORMAL_INVERSE_CDF);
+    EXPECT_EQ(truncated_normal_params<T>(0, 1, 3, 10).method, TRUNCATED_NORMAL_EXPONENTIAL);
+    EXPECT_EQ(truncated_normal_params<T>(0, 1, 3, 3.1).method, TRUNCATED_NORMAL_UNIFORM);
+    // Left tail is mirrored
+    EXPECT_EQ(truncated_normal_params<T>(0, 1, -10, -3).method, TRUNCATED_NORMAL_EXPONENTIAL);
+    EXPECT_EQ(truncated_normal_params<T>(10, 2, 0, 4).method, TRUNCATED_NORMAL_EXPONENTIAL);
+}
+
+template<class T>
+void test_mean()
+{
+    std::mt19937 gen(1234);
+    auto engine = [&]() { return static_cast<unsigned int>(gen()); };
+
+    const double bounds[][2] = { { -1.0, 2.0 }, { 2.0, 3.0 }, { 4.0, 100.0 }, { -3.1, -3.0 } };
+    for(auto b : bounds)
+    {
+        truncated_normal_distribution<T> distribution(0, 1, b[0], b[1]);
+
+        const size_t n = 100000;
+        double mean = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {
+            const T x = distribution(engine);
+            ASSERT_GE(x, static_cast<T>(b[0]));
+            ASSERT_LE(x, static_cast<T>(b[1]));
+            mean += x;
+        }
+        mean /= n;
+
+        const double z = 0.5 * (std::erfc(-b[1] / std::sqrt(2.0)) - std::erfc(-b[0] / std::sqrt(2.0)));
+        const double expected = (std::exp(-b[0] * b[0] / 2) - std::exp(-b[1] * b[1] / 2))
+            / (std::sqrt(2.0 * M_PI) * z);
+        EXPECT_NEAR(mean, expected, 0.01 * (b[1] - b[0]) + 0.01);
+    }
+}
+
+TEST(truncated_normal_distribution_tests, method_test)
+{
+    test_method<float>();
+    test_method<double>();
+}
+
+TEST(truncated_normal_distribution_tests, mean_test)
+{
+    test_mean<float>();
+    test_mean<double>();
+}
@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <map>
 #include <random>
 
 #include <rng/distribution/uniform.hpp>
@@ -78,3 +80,120 @@ TEST(uniform_distribution_tests, double_test)
     EXPECT_EQ(u(UINT_MAX), 1.0);
     EXPECT_GT(u(0U), 0.0);
 }
+
+float half_to_float(unsigned short h)
+{
+    const int exponent = (h >> 10) & 0x1F;
+    const int mantissa = h & 0x3FF;
+    const float sign = (h & 0x8000) ? -1.0f : 1.0f;
+    if(exponent == 0)
+        return sign * std::ldexp(static_cast<float>(mantissa), -24);
+    if(exponent == 31)
+        return mantissa == 0 ? sign * INFINITY : NAN;
+    return sign * std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+}
+
+float bfloat16_to_float(unsigned short h)
+{
+    union { unsigned int u; float f; } v;
+    v.u = static_cast<unsigned int>(h) << 16;
+    return v.f;
+}
+
+TEST(uniform_distribution_tests, float_to_half_test)
+{
+    EXPECT_EQ(half_format::from_float(0.0f), 0x0000);
+    EXPECT_EQ(half_format::from_float(-0.0f), 0x8000);
+    EXPECT_EQ(half_format::from_float(1.0f), 0x3C00);
+    EXPECT_EQ(half_format::from_float(-2.0f), 0xC000);
+    EXPECT_EQ(half_format::from_float(65504.0f), 0x7BFF);
+    EXPECT_EQ(half_format::from_float(65520.0f), 0x7C00);
+    EXPECT_EQ(half_format::from_float(INFINITY), 0x7C00);
+    EXPECT_EQ(half_format::from_float(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(half_format::from_float(std::ldexp(1.0f, -25)), 0x0000);
+    EXPECT_EQ(half_format::from_float(std::ldexp(1.0f, -14)), 0x0400);
+    // Ties to even
+    EXPECT_EQ(half_format::from_float(1.0f + std::ldexp(1.0f, -11)), 0x3C00);
+    EXPECT_EQ(half_format::from_float(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3C02);
+    EXPECT_EQ(half_format::from_float(NAN) & 0x7C00, 0x7C00);
+    EXPECT_NE(half_format::from_float(NAN) & 0x03FF, 0);
+
+    EXPECT_EQ(bfloat16_format::from_float(1.0f), 0x3F80);
+    EXPECT_EQ(bfloat16_format::from_float(-2.0f), 0xC000);
+    EXPECT_EQ(bfloat16_format::from_float(1.0f + std::ldexp(1.0f, -8)), 0x3F80);
+    EXPECT_EQ(bfloat16_format::from_float(1.0f + 3 * std::ldexp(1.0f, -8)), 0x3F82);
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<float> dis(-70000.0f, 70000.0f);
+    for(size_t i = 0; i < 10000; i++)
+    {
+        const float x = dis(gen) * std::pow(2.0f, -static_cast<float>(i % 40));
+        const float h = half_to_float(half_format::from_float(x));
+        if(std::abs(x) < 65504.0f)
+        {
+            EXPECT_NEAR(h, x, std::max(std::abs(x) * std::ldexp(1.0f, -11), std::ldexp(1.0f, -25)));
+        }
+        const float b = bfloat16_to_float(bfloat16_format::from_float(x));
+        EXPECT_NEAR(b, x, std::abs(x) * std::ldexp(1.0f, -8));
+    }
+}
+
+TEST(uniform_distribution_tests, half_test)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<unsigned int> dis;
+
+    uniform_distribution<half_format> u;
+    uniform_distribution<bfloat16_format> b;
+    for(size_t i = 0; i < 100; i++)
+    {
+        unsigned int x = dis(gen);
+        const unsigned int h = u(x);
+        EXPECT_LE(half_to_float(h & 0xFFFF), 1.0f);
+        EXPECT_GT(half_to_float(h & 0xFFFF), 0.0f);
+        EXPECT_LE(half_to_float(h >> 16), 1.0f);
+        EXPECT_GT(half_to_float(h >> 16), 0.0f);
+        const unsigned int v = b(x);
+        EXPECT_LE(bfloat16_to_float(v & 0xFFFF), 1.0f);
+        EXPECT_GT(bfloat16_to_float(v & 0xFFFF), 0.0f);
+    }
+
+    EXPECT_EQ(u(UINT_MAX), 0x3C003C00U);
+    EXPECT_EQ(b(UINT_MAX), 0x3F803F80U);
+    EXPECT_GT(half_to_float(u(0) & 0xFFFF), 0.0f);
+}
+
+TEST(uniform_distribution_tests, half_equal_shares_test)
+{
+    uniform_distribution<half_format> u;
+    uniform_distribution<bfloat16_format> b;
+
+    // Values of (0.5, 1] are spaced by 2^-11 (half) and 2^-8 (bfloat16),
+    // each of them must be produced by the same number of 16-bit inputs
+    std::map<unsigned short, unsigned int> h_counts, b_counts;
+    for(unsigned int v16 = 0; v16 < 65536; v16++)
+    {
+        h_counts[u(v16) & 0xFFFF]++;
+        b_counts[b(v16) & 0xFFFF]++;
+    }
+    for(auto it = h_counts.begin(); it != h_counts.end(); ++it)
+    {
+        const float x = half_to_float(it->first);
+        if(x > 0.5f)
+        {
+            EXPECT_EQ(it->second, 32U) << x;
+        }
+    }
+    for(auto it = b_counts.begin(); it != b_counts.end(); ++it)
+    {
+        const float x = bfloat16_to_float(it->first);
+        if(x > 0.5f)
+        {
+            EXPECT_EQ(it->second, 256U) << x;
+        }
+    }
+    EXPECT_EQ(h_counts[0x3C00], 32U);
+    EXPECT_EQ(b_counts[0x3F80], 256U);
+}
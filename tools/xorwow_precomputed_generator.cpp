@@ -2,6 +2,8 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <cstdlib>
+#include <vector>
 
 
 const int XORWOW_N = 5;  // 5 values
@@ -9,14 +11,26 @@ const int XORWOW_M = 32; // 32-bit each
 
 const int XORWOW_SIZE = XORWOW_M * XORWOW_N * XORWOW_N;
 
-const int XORWOW_JUMP_MATRICES = 32;
-const int XORWOW_JUMP_LOG2 = 2;
+// Jumps are done by digits of XORWOW_JUMP_LOG2 bits
+const int XORWOW_JUMP_LOG2 = 8;
+const int XORWOW_JUMP_VALUES = 1 << XORWOW_JUMP_LOG2;
+const int XORWOW_JUMP_DIGITS = 64 / XORWOW_JUMP_LOG2;
 
 const int XORWOW_SEQUENCE_JUMP_LOG2 = 67;
 
-static unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
-static unsigned int sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
+// Polynomials over GF(2) of degree < 160 (bit i of the 160-bit value is
+// the coefficient of x^i)
+struct polynomial
+{
+    unsigned int c[XORWOW_N];
+};
 
+static polynomial jump_polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES];
+static polynomial sequence_jump_polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES];
+
+// Characteristic polynomial of the transition matrix without the leading
+// term x^160
+static polynomial characteristic;
 
 void copy_mat(unsigned int * dst, const unsigned int * src)
 {
@@ -112,7 +126,202 @@ struct rocrand_xorwow_state
     }
 };
 
-void generate_matrices()
+bool get_bit(const polynomial& p, const int i)
+{
+    return (p.c[i / XORWOW_M] >> (i % XORWOW_M)) & 1;
+}
+
+void flip_bit(polynomial& p, const int i)
+{
+    p.c[i / XORWOW_M] ^= 1U << (i % XORWOW_M);
+}
+
+// v = p(A) v, Horner's scheme
+void apply_polynomial(const polynomial& p, unsigned int * v)
+{
+    rocrand_xorwow_state r = { { 0 }, 0 };
+    for (int i = XORWOW_N * XORWOW_M - 1; i >= 0; i--)
+    {
+        r.discard();
+        if (get_bit(p, i))
+        {
+            for (int k = 0; k < XORWOW_N; k++)
+            {
+                r.x[k] ^= v[k];
+            }
+        }
+    }
+    copy_vec(v, r.x);
+}
+
+// Minimal polynomial of the sequence of the lowest bits of x[0]
+// (Berlekamp-Massey algorithm)
+void generate_characteristic_polynomial()
+{
+    const int n = 2 * XORWOW_N * XORWOW_M;
+    const int size = n + 1;
+
+    rocrand_xorwow_state state = { { 123456789U, 362436069U, 521288629U, 88675123U, 5783321U }, 0 };
+    std::vector<int> s(n);
+    for (int i = 0; i < n; i++)
+    {
+        s[i] = state.x[0] & 1;
+        state.discard();
+    }
+
+    std::vector<int> c(size, 0), b(size, 0);
+    c[0] = b[0] = 1;
+    int l = 0;
+    int m = -1;
+    for (int i = 0; i < n; i++)
+    {
+        int d = s[i];
+        for (int j = 1; j <= l; j++)
+        {
+            d ^= c[j] & s[i - j];
+        }
+        if (d)
+        {
+            std::vector<int> t = c;
+            for (int j = 0; j + i - m < size; j++)
+            {
+                c[j + i - m] ^= b[j];
+            }
+            if (2 * l <= i)
+            {
+                l = i + 1 - l;
+                m = i;
+                b = t;
+            }
+        }
+    }
+
+    if (l != XORWOW_N * XORWOW_M)
+    {
+        std::cerr << "Unexpected degree of the characteristic polynomial: " << l << std::endl;
+        std::exit(-1);
+    }
+
+    // Connection polynomial c(x) is the reciprocal of the characteristic
+    // polynomial: P(x) = x^l + c[1] x^(l - 1) + ... + c[l]
+    characteristic = polynomial { { 0 } };
+    for (int j = 1; j <= l; j++)
+    {
+        if (c[j])
+        {
+            flip_bit(characteristic, l - j);
+        }
+    }
+
+    // Check that P(A) = 0 on every basis vector
+    for (int i = 0; i < XORWOW_N * XORWOW_M; i++)
+    {
+        unsigned int v[XORWOW_N] = { 0 };
+        v[i / XORWOW_M] = 1U << (i % XORWOW_M);
+        unsigned int r[XORWOW_N];
+        copy_vec(r, v);
+        apply_polynomial(characteristic, r);
+        // Add the leading term A^160 v
+        rocrand_xorwow_state state = { { v[0], v[1], v[2], v[3], v[4] }, 0 };
+        for (int j = 0; j < XORWOW_N * XORWOW_M; j++)
+        {
+            state.discard();
+        }
+        for (int k = 0; k < XORWOW_N; k++)
+        {
+            if ((r[k] ^ state.x[k]) != 0)
+            {
+                std::cerr << "Characteristic polynomial is wrong" << std::endl;
+                std::exit(-1);
+            }
+        }
+    }
+}
+
+// a = a * x mod P
+void mul_x_mod(polynomial& a)
+{
+    const bool carry = get_bit(a, XORWOW_N * XORWOW_M - 1);
+    for (int k = XORWOW_N - 1; k > 0; k--)
+    {
+        a.c[k] = (a.c[k] << 1) | (a.c[k - 1] >> (XORWOW_M - 1));
+    }
+    a.c[0] <<= 1;
+    if (carry)
+    {
+        for (int k = 0; k < XORWOW_N; k++)
+        {
+            a.c[k] ^= characteristic.c[k];
+        }
+    }
+}
+
+// a * b mod P
+polynomial mul_mod(const polynomial& a, const polynomial& b)
+{
+    polynomial r = { { 0 } };
+    for (int i = XORWOW_N * XORWOW_M - 1; i >= 0; i--)
+    {
+        mul_x_mod(r);
+        if (get_bit(b, i))
+        {
+            for (int k = 0; k < XORWOW_N; k++)
+            {
+                r.c[k] ^= a.c[k];
+            }
+        }
+    }
+    return r;
+}
+
+// Fills polynomials[i][j] = base^(j * 2^(XORWOW_JUMP_LOG2 * i)) mod P
+void generate_jump_polynomials(polynomial base,
+                               polynomial polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES])
+{
+    const polynomial one = { { 1 } };
+    for (int i = 0; i < XORWOW_JUMP_DIGITS; i++)
+    {
+        polynomials[i][0] = one;
+        for (int j = 1; j < XORWOW_JUMP_VALUES; j++)
+        {
+            polynomials[i][j] = mul_mod(polynomials[i][j - 1], base);
+        }
+        for (int j = 0; j < XORWOW_JUMP_LOG2; j++)
+        {
+            base = mul_mod(base, base);
+        }
+    }
+}
+
+// Compares polynomial jumps with matrix powers
+void check_jump(const polynomial polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES],
+                const unsigned int * one_step,
+                const unsigned long long power)
+{
+    unsigned int a[XORWOW_SIZE];
+    mat_pow(a, one_step, power);
+
+    unsigned int v[XORWOW_N] = { 123456789U, 362436069U, 521288629U, 88675123U, 5783321U };
+    unsigned int r[XORWOW_N];
+    copy_vec(r, v);
+    mul_mat_vec_inplace(a, v);
+    unsigned long long p = power;
+    for (int i = 0; p > 0; i++)
+    {
+        apply_polynomial(polynomials[i][p & (XORWOW_JUMP_VALUES - 1)], r);
+        p >>= XORWOW_JUMP_LOG2;
+    }
+    for (int k = 0; k < XORWOW_N; k++)
+    {
+        if (v[k] != r[k])
+        {
+            std::cerr << "Jump polynomials are wrong" << std::endl;
+            std::exit(-1);
+        }
+    }
+}
+
+void generate_polynomials()
 {
     unsigned int one_step[XORWOW_SIZE];
 
@@ -137,54 +346,41 @@ void generate_matrices()
         }
     }
 
-    {
-        unsigned int a[XORWOW_SIZE];
-        unsigned int b[XORWOW_SIZE];
-        copy_mat(a, one_step);
+    generate_characteristic_polynomial();
 
-        copy_mat(jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(jump_matrices[k], a);
-        }
-    }
+    // A^v = (x^v mod P)(A) because P(A) = 0
+    polynomial x = { { 2 } };
+    generate_jump_polynomials(x, jump_polynomials);
 
+    // x^(2^67) mod P
+    for (int i = 0; i < XORWOW_SEQUENCE_JUMP_LOG2; i++)
     {
-        unsigned int a[XORWOW_SIZE];
-        unsigned int b[XORWOW_SIZE];
-        copy_mat(a, one_step);
-
-        // For 67: A^(2^33)
-        mat_pow(b, a, 1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 / 2));
-        // For 67: (A^(2^33))^(2^34) = A^(2^67)
-        mat_pow(a, b, 1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 - XORWOW_SEQUENCE_JUMP_LOG2 / 2));
-
-        copy_mat(sequence_jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(sequence_jump_matrices[k], a);
-        }
+        x = mul_mod(x, x);
     }
+    generate_jump_polynomials(x, sequence_jump_polynomials);
+
+    check_jump(jump_polynomials, one_step, 1);
+    check_jump(jump_polynomials, one_step, 1234567);
+    check_jump(jump_polynomials, one_step, 0xfedcba9876543210ULL);
 }
 
-void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, bool is_device)
+void write_polynomials(std::ofstream& fout, const std::string name,
+                       const polynomial polynomials[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES],
+                       bool is_device)
 {
-    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name << "[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {" << std::endl;
-    for (int k = 0; k < XORWOW_JUMP_MATRICES; k++)
+    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name
+         << "[XORWOW_JUMP_DIGITS][XORWOW_JUMP_VALUES][XORWOW_N] = {" << std::endl;
+    for (int i = 0; i < XORWOW_JUMP_DIGITS; i++)
     {
         fout << "    {" << std::endl;
-        for (int i = 0; i < XORWOW_M; i++)
+        for (int j = 0; j < XORWOW_JUMP_VALUES; j++)
         {
-            fout << "        ";
-            for (int j = 0; j < XORWOW_N * XORWOW_N; j++)
+            fout << "        { ";
+            for (int k = 0; k < XORWOW_N; k++)
             {
-                fout << a[k * XORWOW_SIZE + i * XORWOW_N * XORWOW_N + j] << ", ";
+                fout << polynomials[i][j].c[k] << "U, ";
             }
-            fout << std::endl;
+            fout << "}," << std::endl;
         }
         fout << "    }," << std::endl;
     }
@@ -201,7 +397,7 @@ int main(int argc, char const *argv[]) {
         return -1;
     }
 
-    generate_matrices();
+    generate_polynomials();
 
     const std::string file_path(argv[1]);
     std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
@@ -235,20 +431,16 @@ int main(int argc, char const *argv[]) {
 
     fout << "#define XORWOW_N " << XORWOW_N << std::endl;
     fout << "#define XORWOW_M " << XORWOW_M << std::endl;
-    fout << "#define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)" << std::endl;
-    fout << "#define XORWOW_JUMP_MATRICES " << XORWOW_JUMP_MATRICES << std::endl;
     fout << "#define XORWOW_JUMP_LOG2 " << XORWOW_JUMP_LOG2 << std::endl;
+    fout << "#define XORWOW_JUMP_VALUES (1 << XORWOW_JUMP_LOG2)" << std::endl;
+    fout << "#define XORWOW_JUMP_DIGITS " << XORWOW_JUMP_DIGITS << std::endl;
     fout << std::endl;
 
-    write_matrices(fout, "d_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), true);
-    write_matrices(fout, "h_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), false);
+    write_polynomials(fout, "d_xorwow_jump_polynomials", jump_polynomials, true);
+    write_polynomials(fout, "h_xorwow_jump_polynomials", jump_polynomials, false);
 
-    write_matrices(fout, "d_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), true);
-    write_matrices(fout, "h_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), false);
+    write_polynomials(fout, "d_xorwow_sequence_jump_polynomials", sequence_jump_polynomials, true);
+    write_polynomials(fout, "h_xorwow_sequence_jump_polynomials", sequence_jump_polynomials, false);
 
     fout << R"(
 #endif // ROCRAND_XORWOW_PRECOMPUTED_H_